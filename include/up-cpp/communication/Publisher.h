@@ -21,8 +21,10 @@
 
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <utility>
+#include <vector>
 
 namespace uprotocol::communication {
 
@@ -43,6 +45,8 @@ struct Publisher {
 	/// @param priority All published messages will be assigned this priority.
 	/// @param ttl How long published messages will be valid from the time
 	///            publish() is called.
+	///
+	/// @throws std::invalid_argument if the transport is null.
 	Publisher(std::shared_ptr<transport::UTransport> transport,
 	          const v1::UUri& topic, v1::UPayloadFormat format,
 	          std::optional<v1::UPriority> priority = {},
@@ -50,14 +54,42 @@ struct Publisher {
 
 	/// @brief Publish a payload to this Publisher's topic.
 	///
+	/// The attributes never change for a given topic, so messages are built
+	/// into a UMessage that is reused from one publish to the next. Only the
+	/// ID and payload are replaced each time. If another thread is already
+	/// publishing with this Publisher, a new message is built instead so
+	/// that publishers never wait on each other.
+	///
 	/// @param A Payload builder containing the payload to be published.
 	[[nodiscard]] v1::UStatus publish(datamodel::builder::Payload&&) const;
 
+	/// @brief Publish several payloads to this Publisher's topic at once.
+	///
+	/// The messages are built (reusing storage from previous batches, as
+	/// with publish()) and then sent with UTransport::sendBatch().
+	///
+	/// @param Payload builders containing the payloads to be published, in
+	///        the order they should be sent.
+	///
+	/// @throws UMessageBuilder::UnexpectedFormat if any payload does not
+	///         have the format given at construction. Nothing is published
+	///         in this case.
+	///
+	/// @returns One UStatus per payload, in the same order as the payloads.
+	[[nodiscard]] std::vector<v1::UStatus> publishBatch(
+	    std::vector<datamodel::builder::Payload>&&) const;
+
 	~Publisher() = default;
 
 private:
 	std::shared_ptr<transport::UTransport> transport_;
 	datamodel::builder::UMessageBuilder publish_builder_;
+
+	/// @brief Message reused by publish(), guarded by message_mutex_
+	mutable v1::UMessage message_;
+	/// @brief Messages reused by publishBatch(), guarded by message_mutex_
+	mutable std::vector<v1::UMessage> batch_;
+	mutable std::mutex message_mutex_;
 };
 
 }  // namespace uprotocol::communication
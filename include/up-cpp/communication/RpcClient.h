@@ -16,14 +16,24 @@
 #include <up-cpp/datamodel/builder/UMessage.h>
 #include <up-cpp/transport/UTransport.h>
 #include <up-cpp/utils/Expected.h>
+#include <up-cpp/utils/Future.h>
 #include <uprotocol/v1/umessage.pb.h>
 #include <uprotocol/v1/ustatus.pb.h>
 
+#include <chrono>
 #include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 
+#ifdef UP_CPP_ENABLE_COROUTINES
+#include <up-cpp/utils/ThreadPool.h>
+
+#include <atomic>
+#include <coroutine>
+#endif
+
 namespace uprotocol::communication {
 
 /// @brief Interface for uEntities to invoke RPC methods.
@@ -31,6 +41,23 @@ namespace uprotocol::communication {
 /// Like all L2 client APIs, the RpcClient is a wrapper on top of the L1
 /// UTransport API; in this instance, it is the request-initiating half of the
 /// RPC model.
+///
+/// Requests awaiting a response are kept in a table keyed on the request ID,
+/// which responses are matched against through their reqid attribute. All
+/// RpcClient instances on a transport share a single response listener on
+/// the transport's default source URI (resource ID 0), which routes each
+/// response to its client by reqid. Creating or destroying a client does not
+/// register or unregister a listener unless it is the first or last client
+/// on its transport.
+///
+/// Requests that are not answered within their TTL are expired by a single
+/// process-wide timer thread, which drives a hierarchical timer wheel shared
+/// by all RpcClient instances. Tracking a request costs O(1) regardless of
+/// how many are in flight.
+///
+/// @remarks Callbacks are called on the transport's thread when a response
+///          arrives, on the timer thread when a request expires, or on the
+///          calling thread if the request could not be sent.
 struct RpcClient {
 	/// @brief Constructs a client connected to a given transport
 	///
@@ -47,6 +74,11 @@ struct RpcClient {
 	///
 	/// For guidance on the permeission_level and token parameters, see:
 	/// https://github.com/eclipse-uprotocol/up-spec/blob/main/basics/permissions.adoc
+	///
+	/// @throws std::invalid_argument if the transport is null.
+	/// @throws std::runtime_error if this is the first client on the
+	///         transport and the shared response listener could not be
+	///         registered.
 	explicit RpcClient(std::shared_ptr<transport::UTransport> transport,
 	                   v1::UUri&& method, v1::UPriority priority,
 	                   std::chrono::milliseconds ttl,
@@ -73,7 +105,7 @@ struct RpcClient {
 	/// @param A callback that will be called with the result.
 	///
 	/// @post The provided callback will be called with one of:
-	///       * A UStatus with a DEADLINE_EXCEEDED code if no response was
+	///       * A Commstatus of DEADLINE_EXCEEDED if no response was
 	///         received before the request expired (based on request TTL).
 	///       * A UStatus with the value returned by UTransport::send().
 	///       * A Commstatus as received in the response message (if not OK).
@@ -88,7 +120,7 @@ struct RpcClient {
 	/// @remarks This is a wrapper around the callback form of invokeMethod.
 	///
 	/// @returns A promised future that can resolve to one of:
-	///          * A UStatus with a DEADLINE_EXCEEDED code if no response was
+	///          * A Commstatus of DEADLINE_EXCEEDED if no response was
 	///            received before the request expired (based on request TTL).
 	///          * A UStatus with the value returned by UTransport::send().
 	///          * A Commstatus as received in the response message (if not OK).
@@ -104,7 +136,7 @@ struct RpcClient {
 	/// @param A callback that will be called with the result.
 	///
 	/// @post The provided callback will be called with one of:
-	///       * A UStatus with a DEADLINE_EXCEEDED code if no response was
+	///       * A Commstatus of DEADLINE_EXCEEDED if no response was
 	///         received before the request expired (based on request TTL).
 	///       * A UStatus with the value returned by UTransport::send().
 	///       * A Commstatus as received in the response message (if not OK).
@@ -119,18 +151,137 @@ struct RpcClient {
 	/// @remarks This is a wrapper around the callback form of invokeMethod.
 	///
 	/// @returns A promised future that can resolve to one of:
-	///          * A UStatus with a DEADLINE_EXCEEDED code if no response was
+	///          * A Commstatus of DEADLINE_EXCEEDED if no response was
 	///            received before the request expired (based on request TTL).
 	///          * A UStatus with the value returned by UTransport::send().
 	///          * A Commstatus as received in the response message (if not OK).
 	///          * A UMessage containing the response from the RPC target.
 	[[nodiscard]] std::future<MessageOrStatus> invokeMethod();
 
-	~RpcClient() = default;
+	/// @brief Invokes an RPC method by sending a request message.
+	///
+	/// @param A Payload builder containing the payload to be sent with the
+	///        request.
+	///
+	/// @remarks Equivalent to invokeMethod(Payload&&), but returns a
+	///          utils::Future. Its shared state comes from a pool and is
+	///          completed without locking, and it supports continuations.
+	///
+	/// @returns A utils::Future that resolves to one of the results listed
+	///          for invokeMethod(Payload&&).
+	[[nodiscard]] utils::Future<MessageOrStatus> invokeMethodPooled(
+	    datamodel::builder::Payload&&);
+
+	/// @brief Invokes an RPC method by sending a request message with an
+	///        empty payload.
+	///
+	/// @remarks Equivalent to invokeMethod(), but returns a utils::Future.
+	///
+	/// @returns A utils::Future that resolves to one of the results listed
+	///          for invokeMethod().
+	[[nodiscard]] utils::Future<MessageOrStatus> invokeMethodPooled();
+
+#ifdef UP_CPP_ENABLE_COROUTINES
+	/// @brief Awaitable result of invokeMethodAsync().
+	///
+	/// The request is sent when the awaiter is co_await-ed, and the awaiting
+	/// coroutine is resumed with the MessageOrStatus that would be passed to
+	/// the callback form of invokeMethod().
+	///
+	/// If no executor was provided, the coroutine is resumed on the thread
+	/// that completes the request (see the RpcClient remarks). Otherwise,
+	/// resuming the coroutine is submitted to the executor. Either way, if
+	/// the request completes before the coroutine has suspended (e.g. it
+	/// could not be sent), the coroutine continues without suspending.
+	///
+	/// If the ThreadPool discards the resume task without running it (its
+	/// queue is full, or it is destroyed), the coroutine is resumed on the
+	/// thread that discarded the task instead.
+	///
+	/// @remarks The awaiting coroutine must not be destroyed while it is
+	///          suspended on the awaiter.
+	class InvokeAwaiter {
+	public:
+		[[nodiscard]] bool await_ready() const noexcept { return false; }
+
+		/// @brief Sends the request.
+		///
+		/// @throws UnexpectedFormat, InvalidUMessage, as for invokeMethod().
+		///
+		/// @returns False if the request has already completed.
+		bool await_suspend(std::coroutine_handle<> awaiting);
+
+		MessageOrStatus await_resume() { return std::move(*result_); }
+
+		InvokeAwaiter(const InvokeAwaiter&) = delete;
+		InvokeAwaiter& operator=(const InvokeAwaiter&) = delete;
+
+	private:
+		friend RpcClient;
+
+		InvokeAwaiter(RpcClient& client,
+		              std::optional<datamodel::builder::Payload>&& payload,
+		              utils::ThreadPool* executor)
+		    : client_(client),
+		      payload_(std::move(payload)),
+		      executor_(executor) {}
+
+		RpcClient& client_;
+		std::optional<datamodel::builder::Payload> payload_;
+		utils::ThreadPool* executor_;
+		std::optional<MessageOrStatus> result_;
+		/// @brief Set by whichever of await_suspend() and the completion
+		///        callback finishes first. The second one resumes.
+		std::atomic<bool> done_{false};
+	};
+
+	/// @brief Invokes an RPC method from a coroutine.
+	///
+	/// @param A Payload builder containing the payload to be sent with the
+	///        request.
+	/// @param executor (Optional) Pool to resume the awaiting coroutine on.
+	///
+	/// @returns An awaiter that resolves to one of the results listed for
+	///          invokeMethod(Payload&&).
+	[[nodiscard]] InvokeAwaiter invokeMethodAsync(
+	    datamodel::builder::Payload&&, utils::ThreadPool* executor = nullptr);
+
+	/// @brief Invokes an RPC method from a coroutine, with an empty payload.
+	///
+	/// Can only be used if no payload format was provided at construction
+	/// time.
+	///
+	/// @param executor (Optional) Pool to resume the awaiting coroutine on.
+	///
+	/// @returns An awaiter that resolves to one of the results listed for
+	///          invokeMethod().
+	[[nodiscard]] InvokeAwaiter invokeMethodAsync(
+	    utils::ThreadPool* executor = nullptr);
+#endif
+
+	/// @brief Requests still awaiting a response are completed with a
+	///        CANCELLED UStatus. The shared response listener is unregistered
+	///        if this is the last client on the transport.
+	~RpcClient();
+
+	RpcClient(const RpcClient&) = delete;
+	RpcClient& operator=(const RpcClient&) = delete;
 
 private:
+	/// @brief Table of requests awaiting a response
+	struct PendingRequests;
+
+	/// @brief Response listener shared by all clients on a transport
+	class ResponseRouter;
+
+	/// @brief Tracks a built request, schedules its expiry, and sends it.
+	void sendRequest(v1::UMessage&& request, Callback&& callback);
+
 	std::shared_ptr<transport::UTransport> transport_;
 	datamodel::builder::UMessageBuilder builder_;
+	std::chrono::milliseconds ttl_;
+	std::shared_ptr<PendingRequests> pending_;
+	std::shared_ptr<ResponseRouter> router_;
 };
 
 }  // namespace uprotocol::communication
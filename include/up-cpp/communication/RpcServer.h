@@ -16,11 +16,15 @@
 #include <up-cpp/datamodel/builder/UMessage.h>
 #include <up-cpp/datamodel/validator/UMessage.h>
 #include <up-cpp/transport/UTransport.h>
+#include <up-cpp/utils/LatencyHistogram.h>
+#include <up-cpp/utils/ThreadPool.h>
 #include <uprotocol/v1/umessage.pb.h>
 #include <uprotocol/v1/uri.pb.h>
 #include <uprotocol/v1/ustatus.pb.h>
 
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -39,6 +43,10 @@ struct RpcServer {
 	/// Callbacks can (optionally) return a Payload builder containing data
 	/// to include in the response message. The payload can only be omitted
 	/// if the payload format was not specified when the RpcServer was created.
+	///
+	/// If the callback throws, or returns a payload in a format other than
+	/// the one specified, the client is sent a response with an INTERNAL
+	/// commstatus.
 	using RpcCallback =
 	    std::function<std::optional<datamodel::builder::Payload>(
 	        const v1::UMessage&)>;
@@ -46,6 +54,59 @@ struct RpcServer {
 	using ServerOrStatus =
 	    utils::Expected<std::unique_ptr<RpcServer>, v1::UStatus>;
 
+	/// @brief Options for running the callback off the transport's thread.
+	///
+	/// Without Dispatch, the callback runs on whichever thread the transport
+	/// delivers requests on, so a slow callback holds up every other
+	/// listener served by that thread.
+	struct Dispatch {
+		/// @brief Runs a task at some later point, on any thread.
+		using Executor = std::function<void(std::function<void()>&&)>;
+
+		/// @brief Gets an Executor that submits tasks to a ThreadPool. The
+		///        pool must outlive any RpcServer using the Executor.
+		static Executor onThreadPool(utils::ThreadPool& pool);
+
+		/// @brief Executor that will run the callback. If empty, the
+		///        callback runs on the transport's thread.
+		///
+		/// @remarks If the executor drops a task without running it (e.g.
+		///          a full ThreadPool queue), no response is sent and the
+		///          client waits for its request to time out. Such tasks
+		///          are counted in DispatchStats::discarded.
+		Executor executor;
+
+		/// @brief Maximum number of requests queued on the executor or
+		///        being handled at once. Requests beyond this are answered
+		///        immediately with a RESOURCE_EXHAUSTED commstatus. 0 means
+		///        no limit.
+		size_t max_in_flight{0};
+	};
+
+	/// @brief Counters for requests received by an RpcServer
+	struct DispatchStats {
+		/// @brief Requests passed to the callback
+		uint64_t handled{0};
+		/// @brief Requests answered with RESOURCE_EXHAUSTED because
+		///        max_in_flight was reached
+		uint64_t rejected{0};
+		/// @brief Requests dropped because they expired before the
+		///        callback could be called
+		uint64_t expired{0};
+		/// @brief Requests dropped by the executor without running
+		uint64_t discarded{0};
+		/// @brief Responses, including error responses, that the transport
+		///        failed to send or rejected as invalid
+		uint64_t send_failed{0};
+		/// @brief Requests currently queued on the executor or being handled
+		size_t in_flight{0};
+		/// @brief Time from a request arriving to its callback being called.
+		///        Only recorded when an executor is used.
+		utils::LatencyHistogram::Snapshot queue_wait;
+		/// @brief Time spent in the callback
+		utils::LatencyHistogram::Snapshot handler_time;
+	};
+
 	/// @brief Creates an RPC server.
 	///
 	/// The callback will remain registered so long as the RpcServer is held.
@@ -63,6 +124,9 @@ struct RpcServer {
 	/// @param ttl (Optional) Time response will be valid from the moment
 	///            respond() is called. Note that the original request's TTL
 	///            may also still apply.
+	/// @param dispatch (Optional) Executor and concurrency limit for calling
+	///                 the callback. Requests that expire while waiting for
+	///                 the executor are dropped without calling the callback.
 	///
 	/// @returns
 	///    * unique_ptr to a RpcServer if the callback was connected
@@ -72,9 +136,21 @@ struct RpcServer {
 	    std::shared_ptr<transport::UTransport> transport,
 	    const v1::UUri& method_name, RpcCallback&& callback,
 	    std::optional<v1::UPayloadFormat> payload_format = {},
-	    std::optional<std::chrono::milliseconds> ttl = {});
+	    std::optional<std::chrono::milliseconds> ttl = {},
+	    std::optional<Dispatch> dispatch = {});
+
+	/// @brief Disconnects the callback, then waits for any callbacks that
+	///        are running to return. Requests still queued on the executor
+	///        are dropped.
+	///
+	/// @remarks Must not be called from within the callback.
+	~RpcServer();
+
+	RpcServer(const RpcServer&) = delete;
+	RpcServer& operator=(const RpcServer&) = delete;
 
-	~RpcServer() = default;
+	/// @brief Gets the counters for requests received so far
+	[[nodiscard]] DispatchStats dispatchStats() const;
 
 protected:
 	/// @brief Constructs an RPC server connected to a given transport.
@@ -89,10 +165,17 @@ protected:
 	/// @param ttl (Optional) Time response will be valid from the moment
 	///            respond() is called. Note that the original request's TTL
 	///            may also still apply.
+	/// @param dispatch (Optional) Executor and concurrency limit for calling
+	///                 the callback.
+	///
+	/// @throws std::invalid_argument if the transport is null.
+	/// @throws datamodel::validator::uri::InvalidUUri if the method is not a
+	///         valid RPC method URI.
 	RpcServer(std::shared_ptr<transport::UTransport> transport,
 	          const v1::UUri& method,
 	          std::optional<v1::UPayloadFormat> format = {},
-	          std::optional<std::chrono::milliseconds> ttl = {});
+	          std::optional<std::chrono::milliseconds> ttl = {},
+	          std::optional<Dispatch> dispatch = {});
 
 	/// @brief Connects the RPC callback method and returns the status from
 	///        UTransport::registerListener.
@@ -103,14 +186,23 @@ protected:
 	[[nodiscard]] v1::UStatus connect(RpcCallback&& callback);
 
 private:
+	/// @brief Calls the RPC callback and sends responses. Shared with tasks
+	///        queued on the executor, which may outlive the RpcServer.
+	class Handler;
+
 	/// @brief Transport instance that will be used for communication
 	std::shared_ptr<transport::UTransport> transport_;
 
-	/// @brief TTL to use for responses, if set at construction time
-	std::optional<std::chrono::milliseconds> ttl_;
+	/// @brief Method URI requests are received on
+	v1::UUri method_;
 
-	/// @brief RPC callback method
-	RpcCallback callback_;
+	/// @brief Request handling state, set by connect()
+	std::shared_ptr<Handler> handler_;
+
+	/// @brief Response options and dispatch settings, used by connect()
+	std::optional<v1::UPayloadFormat> format_;
+	std::optional<std::chrono::milliseconds> ttl_;
+	std::optional<Dispatch> dispatch_;
 
 	/// @brief Handle to the connected callback for the RPC method wrapper
 	transport::UTransport::ListenHandle callback_handle_;
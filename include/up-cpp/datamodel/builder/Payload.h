@@ -15,6 +15,7 @@
 #include <uprotocol/v1/uattributes.pb.h>
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -35,6 +36,9 @@ struct Payload {
 	/// @brief The two types of data that can be stored in a Serialized payload.
 	enum PayloadType { Data, Format };
 
+	/// @brief An immutable, reference counted serialized payload.
+	using SharedSerialized = std::shared_ptr<const Serialized>;
+
 	/// @brief Constructs a Payload builder with the payload populated by
 	///        a serialized protobuf.
 	///
@@ -131,6 +135,21 @@ struct Payload {
 	///                           for v1::UPayloadFormat
 	explicit Payload(Serialized&&);
 
+	/// @brief Creates a Payload builder that refers to shared, immutable
+	///        pre-serialized data.
+	///
+	/// Copies of this Payload share the same data rather than duplicating
+	/// it, so one payload can be handed to many Publishers or
+	/// NotificationSources with a single allocation. The data is copied
+	/// only when it is placed in a UMessage (see buildMove()).
+	///
+	/// @param A shared pairing of pre-serialized data and a format.
+	///
+	/// @throws std::invalid_argument If the pointer is null
+	/// @throws std::out_of_range If the serialized payload format is not valid
+	///                           for v1::UPayloadFormat
+	explicit Payload(SharedSerialized);
+
 	/// @brief Move constructor.
 	Payload(Payload&&) noexcept;
 
@@ -168,10 +187,35 @@ struct Payload {
 	///
 	/// @throws PayloadMoved if called after buildMove() has already been
 	/// called.
+	///
+	/// @remarks If this Payload refers to shared data, the data is copied
+	///          and the shared data is left untouched.
 	[[nodiscard]] Serialized buildMove() &&;
 
+	/// @brief Get the internal data as shared, immutable data that can be
+	///        used to construct any number of Payloads without copying.
+	///
+	/// If this Payload already refers to shared data, that is returned.
+	/// Otherwise, the data is moved (not copied) into a new shared buffer.
+	///
+	/// @post This Payload builder will no longer be valid, as with
+	///       buildMove().
+	///
+	/// @throws PayloadMoved if called after buildMove() has already been
+	/// called.
+	[[nodiscard]] SharedSerialized buildShared() &&;
+
+	/// @brief Checks if this Payload refers to shared data.
+	///
+	/// @returns True if this Payload was constructed from SharedSerialized
+	///          and has not been moved out of, false otherwise.
+	[[nodiscard]] bool isShared() const;
+
 private:
+	/// @brief Payload data, unless shared_ is set
 	Serialized payload_;
+	/// @brief Shared payload data, if constructed from SharedSerialized
+	SharedSerialized shared_;
 	bool moved_{false};
 };
 
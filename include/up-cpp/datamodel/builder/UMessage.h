@@ -12,6 +12,7 @@
 #ifndef UP_CPP_DATAMODEL_BUILDER_UMESSAGE_H
 #define UP_CPP_DATAMODEL_BUILDER_UMESSAGE_H
 
+#include <google/protobuf/arena.h>
 #include <up-cpp/datamodel/builder/Payload.h>
 #include <uprotocol/v1/uattributes.pb.h>
 #include <uprotocol/v1/umessage.pb.h>
@@ -19,6 +20,7 @@
 #include <uprotocol/v1/uuid.pb.h>
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -198,6 +200,27 @@ struct UMessageBuilder {
 	/// @returns A reference to this UMessageBuilder
 	UMessageBuilder& withPayloadFormat(v1::UPayloadFormat);
 
+	/// @brief Draws message IDs from a prefetched block of UUIDs instead of
+	///        building a new UUID for every message.
+	///
+	/// Blocks are reserved with UuidBuilder::buildBatch(), so the shared UUID
+	/// state is updated once per block rather than once per message. Copies
+	/// of this builder share the same block.
+	///
+	/// @remarks Every ID in a block carries the time at which the block was
+	///          reserved, and the ID time is treated as the message creation
+	///          time (e.g. for TTL expiry). To keep that time accurate, the
+	///          rest of a block is dropped once the clock moves on to the
+	///          next millisecond, so this only helps publishers that build
+	///          messages in bursts.
+	///
+	/// @param Number of IDs to reserve at a time, at most 4096 (the number
+	///        of UUIDs that can share a timestamp). Larger values are clamped.
+	///        0 disables prefetching.
+	///
+	/// @returns A reference to this UMessageBuilder
+	UMessageBuilder& withIdPrefetch(size_t block_size);
+
 	/// @brief This exception indicates that build was called and the payload
 	///        format did not match the one set with withPayloadFormat().
 	struct UnexpectedFormat : public std::invalid_argument {
@@ -232,6 +255,70 @@ struct UMessageBuilder {
 	/// @return A built message with the provided payload data embedded.
 	[[nodiscard]] v1::UMessage build(builder::Payload&&) const;
 
+	/// @brief Creates a UMessage on a protobuf Arena based on the builder's
+	///        current state.
+	///
+	/// @remarks Strings in the message (e.g. authority names) are placed on
+	///          the arena, but long string contents are still allocated by
+	///          std::string. Use buildInto() with a reused message to avoid
+	///          those allocations as well.
+	///
+	/// @param The arena to allocate the message from.
+	///
+	/// @throws UnexpectedFormat if withPayloadFormat() has been previously
+	///         called.
+	///
+	/// @return A built message with no payload populated. The message is
+	///         owned by the arena.
+	[[nodiscard]] v1::UMessage* build(google::protobuf::Arena&) const;
+
+	/// @brief Creates a UMessage on a protobuf Arena with a provided payload
+	///        based on the builder's current state.
+	///
+	/// @param The arena to allocate the message from.
+	/// @param A Payload builder containing a payload to embed in the message.
+	///
+	/// @note The contents of the payload builder will be moved.
+	///
+	/// @throws UnexpectedFormat if withPayloadFormat() has been previously
+	///         called and the format in the payload builder does not match.
+	///
+	/// @return A built message with the provided payload data embedded. The
+	///         message is owned by the arena.
+	[[nodiscard]] v1::UMessage* build(google::protobuf::Arena&,
+	                                  builder::Payload&&) const;
+
+	/// @brief Overwrites an existing UMessage based on the builder's current
+	///        state.
+	///
+	/// Storage already held by the message, such as the URIs and their
+	/// authority strings, is reused. A message that is rebuilt over and
+	/// over (e.g. for periodic publishing) stops touching the allocator
+	/// once its fields have grown to size.
+	///
+	/// @param The message to overwrite.
+	///
+	/// @throws UnexpectedFormat if withPayloadFormat() has been previously
+	///         called. The message is not modified in this case.
+	void buildInto(v1::UMessage&) const;
+
+	/// @brief Overwrites an existing UMessage with a provided payload based
+	///        on the builder's current state.
+	///
+	/// Storage already held by the message is reused, as with
+	/// buildInto(v1::UMessage&). Shared payload data is copied into the
+	/// message's existing payload buffer.
+	///
+	/// @param The message to overwrite.
+	/// @param A Payload builder containing a payload to embed in the message.
+	///
+	/// @note The contents of the payload builder will be moved.
+	///
+	/// @throws UnexpectedFormat if withPayloadFormat() has been previously
+	///         called and the format in the payload builder does not match.
+	///         The message is not modified in this case.
+	void buildInto(v1::UMessage&, builder::Payload&&) const;
+
 	/// @brief Access the attributes of the message being built.
 	/// @return A reference to the attributes of the message being built.
 	[[nodiscard]] const v1::UAttributes& attributes() const {
@@ -251,10 +338,21 @@ private:
 
 	void setPayloadFormat(v1::UPayloadFormat);
 
+	/// @brief Gets the ID for the next message built
+	v1::UUID nextId() const;
+
+	/// @brief Overwrites the attributes of a message with attributes_ and a
+	///        new ID, reusing the message's existing storage.
+	void writeAttributes(v1::UAttributes&) const;
+
 	/// @brief The attributes of the message being built
 	v1::UAttributes attributes_;
 	std::optional<v1::UPayloadFormat> expectedPayloadFormat_;
 	mutable UuidBuilder uuidBuilder_;
+
+	/// @brief Block of prefetched IDs, if enabled with withIdPrefetch()
+	struct IdBlock;
+	std::shared_ptr<IdBlock> idBlock_;
 };
 
 }  // namespace uprotocol::datamodel::builder
@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 namespace uprotocol::datamodel::builder {
 
@@ -97,11 +98,49 @@ struct UuidBuilder {
 	/// @remarks As part of the UUID v7/v8 spec, there is a shared state for
 	///          all UUID builders within a process. Test builders can override
 	///          this with the withIndependentState() interface.
+	///
+	/// @note Safe to call concurrently, including on copies of a builder that
+	///       share the same state. Every call returns a distinct UUID until
+	///       the counter freezes (more than 4096 UUIDs in one millisecond).
+	///       Time and random sources set in test mode must also be safe to
+	///       call concurrently.
 	v1::UUID build();
 
+	/// @brief Creates a batch of consecutive uProtocol UUIDs.
+	///
+	/// The whole batch is reserved with a single time read and a single
+	/// update of the shared state, so this is much cheaper than calling
+	/// build() repeatedly. All UUIDs in the batch share the same timestamp.
+	///
+	/// @remarks If the batch needs more counter values than remain in the
+	///          current timestamp tick, the counter freezes at its maximum
+	///          value for the rest of the batch, exactly as it would with
+	///          repeated calls to build().
+	///
+	/// @param count Number of UUIDs to build.
+	/// @returns The UUIDs, in the order they were assigned.
+	std::vector<v1::UUID> buildBatch(size_t count);
+
+	/// @brief Creates a batch of consecutive uProtocol UUIDs in place.
+	///
+	/// Same as buildBatch(size_t), but writes into existing UUID objects.
+	///
+	/// @param uuids First of `count` contiguous UUIDs to overwrite.
+	/// @param count Number of UUIDs to build.
+	void buildBatch(v1::UUID* uuids, size_t count);
+
 private:
 	UuidBuilder(bool testing);
 
+	/// @brief Reserves `count` consecutive counter values from the shared
+	///        state. A count of zero reserves one value.
+	///
+	/// @returns The first reserved value as (unix_ts_ms << 12) | counter.
+	uint64_t reserve(size_t count);
+
+	/// @brief Gets the random part of the UUID, initializing it on first use.
+	uint64_t randB();
+
 	const bool testing_{false};
 	std::function<std::chrono::system_clock::time_point()> time_source_;
 	std::function<uint64_t()> random_source_;
@@ -14,7 +14,11 @@
 
 #include <uprotocol/v1/uri.pb.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 /// @brief Collection of interfaces for converting uprotocol::v1::UUri objects
 ///        between protobuf and alternative representations.
@@ -23,10 +27,97 @@ namespace uprotocol::datamodel::serializer::uri {
 /// @brief Converts to and from a human-readable string representation of UUri
 ///        according to the UUri spec.
 struct AsString {
-	[[nodiscard]] static std::string serialize(const v1::UUri&);
+	/// @brief Size of a fixed buffer for serialize(). This fits any UUri
+	///        with an authority name of up to 128 characters.
+	static constexpr size_t BUFFER_SIZE = 256;
+
+	/// @brief Whether serialize() validates the UUri before formatting it
+	enum class Validation {
+		/// @brief Check with validator::uri::isValid() and throw
+		///        std::invalid_argument if the UUri is not valid.
+		CHECKED,
+		/// @brief Skip validation for UUris already known to be valid, such
+		///        as those that passed through a validating builder or
+		///        deserializer.
+		TRUSTED
+	};
+
+	[[nodiscard]] static std::string serialize(
+	    const v1::UUri&, Validation validation = Validation::CHECKED);
+
+	/// @brief Serializes into an existing string, reusing its capacity.
+	///
+	/// @post `out` contains only the serialized UUri.
+	static void serialize(const v1::UUri&, std::string& out,
+	                      Validation validation = Validation::CHECKED);
+
+	/// @brief Serializes into a fixed-size buffer without allocating.
+	///
+	/// @returns View of the serialized UUri within `buffer`. No null
+	///          terminator is written.
+	///
+	/// @throws std::length_error if the serialized UUri might not fit.
+	static std::string_view serialize(
+	    const v1::UUri&, char (&buffer)[BUFFER_SIZE],
+	    Validation validation = Validation::CHECKED);
+
 	[[nodiscard]] static v1::UUri deserialize(const std::string&);
 };
 
+/// @brief Converts to and from a compact, fixed-layout binary representation
+///        of UUri, for use as hash and cache keys or in wire headers.
+///
+/// Layout (multi-byte fields are big-endian):
+///
+///     Offset | Size | Field
+///     -------+------+-----------------------------
+///          0 |    4 | ue_id
+///          4 |    2 | resource_id
+///          6 |    1 | ue_version_major
+///          7 |    1 | authority name length (N)
+///          8 |    N | authority name
+///
+/// Every UUri has exactly one encoding, so two encoded UUris are equal iff
+/// their bytes are equal (memcmp). Because the numeric fields are stored
+/// big-endian, memcmp ordering groups keys by ue_id, then resource_id.
+///
+/// @remarks The UUri is not validated beyond checking that each field fits
+///          its encoded size, so wildcard filters can be encoded too.
+struct AsBytes {
+	/// @brief Size of the fixed portion preceding the authority name
+	static constexpr size_t HEADER_SIZE = 8;
+	/// @brief Longest authority name that can be encoded
+	static constexpr size_t MAX_AUTHORITY_SIZE = UINT8_MAX;
+	/// @brief Size of a buffer that can hold any encoded UUri
+	static constexpr size_t MAX_SIZE = HEADER_SIZE + MAX_AUTHORITY_SIZE;
+
+	/// @brief Number of bytes needed to encode a UUri
+	[[nodiscard]] static size_t serializedSize(const v1::UUri&);
+
+	/// @throws std::invalid_argument if a field does not fit the layout
+	[[nodiscard]] static std::vector<uint8_t> serialize(const v1::UUri&);
+
+	/// @brief Encodes into a caller-supplied buffer without allocating.
+	///
+	/// @returns Number of bytes written
+	///
+	/// @throws std::invalid_argument if a field does not fit the layout
+	/// @throws std::length_error if the buffer is too small
+	static size_t serialize(const v1::UUri&, uint8_t* buffer, size_t size);
+
+	/// @throws std::invalid_argument if the bytes are not exactly one
+	///         encoded UUri
+	[[nodiscard]] static v1::UUri deserialize(const std::vector<uint8_t>&);
+
+	/// @brief Decodes the UUri at the start of a buffer. Any bytes following
+	///        it are ignored; serializedSize() on the result gives the
+	///        number of bytes consumed.
+	///
+	/// @throws std::invalid_argument if the buffer is too short
+	[[nodiscard]] static v1::UUri deserialize(const uint8_t* buffer,
+	                                          size_t size);
+};
+
 }  // namespace uprotocol::datamodel::serializer::uri
 
 #endif  // UP_CPP_DATAMODEL_SERIALIZER_UURI_H
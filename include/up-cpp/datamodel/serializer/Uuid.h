@@ -14,8 +14,10 @@
 
 #include <uprotocol/v1/uuid.pb.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 /// @brief Collection of interfaces for converting uprotocol::v1::UUID objects
@@ -26,9 +28,24 @@
 namespace uprotocol::datamodel::serializer::uuid {
 
 /// @brief Converts to and from a human-readable string representation of UUID
+///
+/// @remarks Strings are in the form "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx"
+///          with lowercase hex digits. Deserialization also accepts
+///          uppercase digits.
 struct AsString {
+	/// @brief Length of a serialized UUID string (no null terminator)
+	static constexpr size_t STRING_LENGTH = 36;
+
 	[[nodiscard]] static std::string serialize(v1::UUID);
-	[[nodiscard]] static v1::UUID deserialize(const std::string&);
+
+	/// @brief Writes the string representation of a UUID into a
+	///        caller-supplied buffer without allocating.
+	///
+	/// @remarks No null terminator is written.
+	static void serialize(const v1::UUID&, char (&buffer)[STRING_LENGTH]);
+
+	/// @throws std::invalid_argument if the string is not a well-formed UUID
+	[[nodiscard]] static v1::UUID deserialize(std::string_view);
 };
 
 /// @brief Converts to and from byte vector representation of UUID
@@ -69,12 +69,15 @@ using ValidationResult = std::tuple<bool, std::optional<Reason>>;
 
 /// @brief Checks if UMessage is a valid UMessage of any format.
 ///
-/// A UMessage is valid if any of these are true:
+/// The message is checked only against the rules for the type set in its
+/// attributes, i.e. one of:
 ///
 ///   * isValidRpcRequest()
 ///   * isValidRpcResponse()
 ///   * isValidPublish()
 ///   * isValidNotification()
+///
+/// Messages without one of those types fail with WRONG_MESSAGE_TYPE.
 [[nodiscard]] ValidationResult isValid(const v1::UMessage&);
 
 /// @brief Checks if common attributes for all UMessage types are valid
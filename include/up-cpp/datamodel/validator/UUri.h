@@ -14,8 +14,13 @@
 
 #include <uprotocol/v1/uri.pb.h>
 
+#include <cstdint>
 #include <optional>
 
+namespace uprotocol::utils {
+class UUriKey;
+}  // namespace uprotocol::utils
+
 /// @brief Validators for UUri objects.
 namespace uprotocol::datamodel::validator::uri {
 
@@ -101,6 +106,16 @@ using ValidationResult = std::tuple<bool, std::optional<Reason>>;
 /// must be in the range [0x8000, 0xFFFE].
 [[nodiscard]] ValidationResult isValidSubscription(const v1::UUri&);
 
+/// @brief Checks if UUri is valid as a sink or source filter when
+///        registering a listener.
+///
+/// The UUri must not be empty. Filters without wildcards must pass the
+/// isValid() check. Filters with wildcards may use them in any field, but
+/// resource_id must not be greater than 0xFFFF. The only authority wildcard
+/// is a bare "*"; an authority that merely contains '*' (e.g. "host*") is
+/// rejected with DISALLOWED_WILDCARD.
+[[nodiscard]] ValidationResult isValidFilter(const v1::UUri&);
+
 /// @brief Checks if a URI is empty.
 ///
 /// An Empty URI is one where all of these conditions are met:
@@ -122,6 +137,38 @@ using ValidationResult = std::tuple<bool, std::optional<Reason>>;
 /// Checks for all types of wildcards, returns true if any are found.
 [[nodiscard]] bool uses_wildcards(const v1::UUri&);
 
+/// @brief  Checks if the UUri a key was made from uses wildcards
+///
+/// Gives the same result as the UUri overload. The wildcard fields are
+/// found when the key is made, so this does not search the authority name.
+[[nodiscard]] bool uses_wildcards(const utils::UUriKey&);
+
+/// @brief Set of Form bits
+using FormMask = uint8_t;
+
+/// @brief UUri forms reported by classify(). Each corresponds to one of the
+///        isValid*() checks above.
+enum Form : FormMask {
+	RPC_METHOD = 1 << 0,      ///< isValidRpcMethod()
+	RPC_RESPONSE = 1 << 1,    ///< isValidRpcResponse()
+	DEFAULT_SOURCE = 1 << 2,  ///< isValidDefaultSource()
+	PUBLISH_TOPIC = 1 << 3,   ///< isValidPublishTopic()
+	NOTIFICATION = 1 << 4,    ///< isValidNotification()
+	SUBSCRIPTION = 1 << 5,    ///< isValidSubscription()
+	FILTER = 1 << 6,          ///< isValidFilter()
+
+	/// @brief Forms accepted by isValid()
+	ANY_MESSAGE_FORM = RPC_METHOD | RPC_RESPONSE | PUBLISH_TOPIC | NOTIFICATION
+};
+
+/// @brief Determines every form a UUri is valid for in a single pass.
+///
+/// For each Form, the bit is set iff the corresponding isValid*() check
+/// would return true. This is cheaper than calling several checks in turn
+/// when only the outcome is needed. The individual checks should still be
+/// used to get the Reason a UUri is not valid.
+[[nodiscard]] FormMask classify(const v1::UUri&);
+
 /// @brief This exception indicates that a UUri object was provided that
 ///        did not contain valid UUri data.
 ///
@@ -61,6 +61,19 @@ ValidationResult isUuid(v1::UUID);
 /// @returns True if the difference between the current system time and
 ///          the the timestamp in the UUID is greater than the TTL.
 ValidationResult isExpired(v1::UUID uuid, std::chrono::milliseconds ttl);
+
+/// @brief Same as isUuid(v1::UUID), but checks the timestamp against a time
+///        the caller has already read from the system clock.
+///
+/// Callers checking several UUIDs, or a UUID and its expiry, can read the
+/// clock once and pass it to each check.
+ValidationResult isUuid(const v1::UUID&,
+                        std::chrono::system_clock::time_point now);
+
+/// @brief Same as isExpired(v1::UUID, std::chrono::milliseconds), but checks
+///        against a time the caller has already read from the system clock.
+ValidationResult isExpired(const v1::UUID& uuid, std::chrono::milliseconds ttl,
+                           std::chrono::system_clock::time_point now);
 /// @}
 
 /// @name Inspection utilities
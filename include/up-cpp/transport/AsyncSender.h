@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_TRANSPORT_ASYNCSENDER_H
+#define UP_CPP_TRANSPORT_ASYNCSENDER_H
+
+#include <up-cpp/transport/UTransport.h>
+#include <up-cpp/utils/PriorityScheduler.h>
+#include <uprotocol/v1/uattributes.pb.h>
+#include <uprotocol/v1/umessage.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace uprotocol::transport {
+
+/// @brief Non-blocking front end for UTransport::send().
+///
+/// Messages passed to sendAsync() are placed in a bounded outbound queue and
+/// the call returns immediately. A dedicated thread drains the queue through
+/// UTransport::send(), so a slow transport only stalls that thread.
+///
+/// The queue is drained by a utils::PriorityScheduler using the UPriority in
+/// each message's attributes. By default this is strict priority order (CS6
+/// first). Weighted fair queuing between classes can be selected instead.
+/// Messages of the same priority are sent in the order they were queued.
+/// UPRIORITY_UNSPECIFIED is treated as CS1, the default class.
+///
+/// One AsyncSender is intended to be shared by all users of a transport so
+/// that there is a single outbound queue per transport.
+class AsyncSender {
+public:
+	/// @brief Called with the result of sending a message. Runs on the
+	///        sender thread, except for messages rejected by sendAsync()
+	///        which complete on the calling thread. Exceptions thrown by a
+	///        callback are caught and ignored.
+	using Callback = std::function<void(v1::UStatus)>;
+
+private:
+	/// @brief A queued message
+	struct Entry {
+		v1::UMessage message;
+		Callback callback;
+	};
+
+public:
+	/// @brief What sendAsync() does when the outbound queue is full.
+	enum class Backpressure {
+		/// @brief The new message is not queued. Its completion reports
+		///        RESOURCE_EXHAUSTED.
+		REJECT,
+		/// @brief sendAsync() blocks until there is room in the queue.
+		///
+		/// @remarks Calling sendAsync() from a Callback can then deadlock,
+		///          since callbacks run on the thread that drains the queue.
+		BLOCK,
+		/// @brief The oldest message of the lowest queued priority is
+		///        discarded to make room, provided it is not of a higher
+		///        priority than the new message. Otherwise, the new message
+		///        is rejected. The discarded message's completion reports
+		///        RESOURCE_EXHAUSTED.
+		DROP_OLDEST
+	};
+
+	/// @brief Default maximum number of queued messages
+	static constexpr size_t DEFAULT_QUEUE_SIZE = 1024;
+
+	/// @brief Scheduler used to order the outbound queue
+	using Scheduler = utils::PriorityScheduler<Entry>;
+
+	/// @brief Constructor
+	///
+	/// @param transport Transport that messages will be sent through.
+	/// @param max_queue_size Maximum number of messages waiting to be sent.
+	///                       Values below 1 are treated as 1.
+	/// @param backpressure Behavior when the queue is full.
+	/// @param scheduling How the queue is ordered between priority classes.
+	/// @param weights For WEIGHTED_FAIR scheduling, relative share of each
+	///                class.
+	///
+	/// @throws std::invalid_argument if the transport is null.
+	explicit AsyncSender(
+	    std::shared_ptr<UTransport> transport,
+	    size_t max_queue_size = DEFAULT_QUEUE_SIZE,
+	    Backpressure backpressure = Backpressure::REJECT,
+	    Scheduler::Policy scheduling = Scheduler::Policy::STRICT,
+	    const Scheduler::Weights& weights = Scheduler::DEFAULT_WEIGHTS);
+
+	/// @brief Stops the sender thread once its current message is sent.
+	///        Messages still queued complete with CANCELLED.
+	~AsyncSender();
+
+	AsyncSender(const AsyncSender&) = delete;
+	AsyncSender(AsyncSender&&) = delete;
+	AsyncSender& operator=(const AsyncSender&) = delete;
+	AsyncSender& operator=(AsyncSender&&) = delete;
+
+	/// @brief Queue a message to be sent.
+	///
+	/// @param message UMessage to be sent.
+	/// @param callback Called with the status returned by UTransport::send()
+	///                 once the message has been sent, or with a failure
+	///                 status if it could not be. If send() throws
+	///                 InvalidUMessage, the status is INVALID_ARGUMENT. Any
+	///                 other exception gives INTERNAL.
+	///
+	/// @throws std::invalid_argument if the callback is empty.
+	void sendAsync(v1::UMessage&& message, Callback&& callback);
+
+	/// @brief Queue a message to be sent.
+	///
+	/// @param message UMessage to be sent.
+	///
+	/// @returns A future that receives the status, as it would be passed to
+	///          the callback of sendAsync(v1::UMessage&&, Callback&&).
+	[[nodiscard]] std::future<v1::UStatus> sendAsync(v1::UMessage&& message);
+
+	/// @brief Gets the number of messages waiting to be sent.
+	[[nodiscard]] size_t queueSize() const;
+
+	/// @brief Gets the number of messages rejected or discarded because the
+	///        queue was full.
+	[[nodiscard]] uint64_t droppedCount() const;
+
+	/// @brief Gets queue depth and wait time counters for the class a
+	///        priority is scheduled in.
+	[[nodiscard]] Scheduler::ClassStats queueStats(v1::UPriority) const;
+
+private:
+	/// @brief Sender thread main loop
+	void run();
+
+	const std::shared_ptr<UTransport> transport_;
+	const size_t maxQueueSize_;
+	const Backpressure backpressure_;
+
+	mutable std::mutex mutex_;
+	std::condition_variable notEmpty_;
+	std::condition_variable notFull_;
+	Scheduler queue_;
+	bool stop_{false};
+	std::atomic<uint64_t> dropped_{0};
+
+	std::thread thread_;
+};
+
+}  // namespace uprotocol::transport
+
+#endif  // UP_CPP_TRANSPORT_ASYNCSENDER_H
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_TRANSPORT_LOOPBACKTRANSPORT_H
+#define UP_CPP_TRANSPORT_LOOPBACKTRANSPORT_H
+
+#include <up-cpp/transport/UTransport.h>
+#include <up-cpp/utils/UUriMatcher.h>
+#include <uprotocol/v1/umessage.pb.h>
+#include <uprotocol/v1/uri.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+
+namespace uprotocol::transport {
+
+/// @brief In-process transport that delivers every sent message directly to
+///        the listeners registered on the same transport instance.
+///
+/// Messages never leave the process, so uEntities that share a
+/// LoopbackTransport instance can communicate without a network hop. It is
+/// also a realistic baseline for measuring the cost of the layers above
+/// UTransport.
+///
+/// Listeners are matched against the message's delivery address: the sink
+/// when one is set, or the source for messages that do not carry a sink
+/// (i.e. published messages). If a source filter was provided, the message
+/// source must also match it.
+///
+/// Sink filters, including those with wildcards, are kept in a
+/// utils::UUriMatcher so that the cost of delivering a message does not grow
+/// with the number of registered listeners.
+///
+/// @remarks Messages are delivered synchronously on the thread that called
+///          send(). Listeners are invoked without any internal locks held,
+///          so they are free to send messages or (un)register listeners.
+class LoopbackTransport : public UTransport {
+public:
+	/// @brief Constructor
+	///
+	/// @param Default Authority and Entity (as a UUri) for clients using this
+	///        transport instance.
+	///
+	/// @throws InvalidUUri if the provided UUri is not valid as a default
+	///         source.
+	explicit LoopbackTransport(const v1::UUri&);
+
+	/// @brief Gets the number of listeners currently registered with this
+	///        transport.
+	[[nodiscard]] size_t listenerCount() const;
+
+	~LoopbackTransport() override = default;
+
+protected:
+	/// @brief Delivers a message to all local listeners.
+	///
+	/// @returns OKSTATUS once all matching listeners have been called.
+	[[nodiscard]] v1::UStatus sendImpl(const v1::UMessage& message) override;
+
+	/// @brief Adds a listener to the dispatch index.
+	///
+	/// @returns OKSTATUS
+	[[nodiscard]] v1::UStatus registerListenerImpl(
+	    const v1::UUri& sink_filter, CallableConn&& listener,
+	    std::optional<v1::UUri>&& source_filter) override;
+
+	/// @brief Removes a disconnected listener from the dispatch index.
+	void cleanupListener(CallableConn listener) override;
+
+	/// @brief Calls every registered listener that matches the message.
+	///
+	/// Derived transports that receive messages from elsewhere can use this
+	/// to hand those messages to their local listeners.
+	///
+	/// @returns The number of listeners that were called.
+	size_t dispatch(const v1::UMessage& message);
+
+private:
+	/// @brief A single registered listener along with its source filter.
+	struct Registration {
+		CallableConn listener;
+		std::optional<v1::UUri> source_filter;
+	};
+
+	using SinkIndex = utils::UUriMatcher<Registration>;
+
+	/// @brief Checks if a UUri matches a filter that may contain wildcards.
+	static bool matches(const v1::UUri& filter, const v1::UUri& uri);
+
+	/// @brief Protects all of the listener containers below
+	mutable std::shared_mutex listeners_mtx_;
+
+	/// @brief Registered listeners, indexed by sink filter
+	SinkIndex sink_index_;
+
+	/// @brief Reverse lookup used by cleanupListener()
+	std::map<CallableConn, SinkIndex::Id> listener_ids_;
+};
+
+}  // namespace uprotocol::transport
+
+#endif  // UP_CPP_TRANSPORT_LOOPBACKTRANSPORT_H
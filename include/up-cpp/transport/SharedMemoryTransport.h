@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_TRANSPORT_SHAREDMEMORYTRANSPORT_H
+#define UP_CPP_TRANSPORT_SHAREDMEMORYTRANSPORT_H
+
+#include <up-cpp/transport/LoopbackTransport.h>
+#include <uprotocol/v1/umessage.pb.h>
+#include <uprotocol/v1/uri.pb.h>
+#include <uprotocol/v1/ustatus.pb.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace uprotocol::transport {
+
+/// @brief Transport for exchanging messages between processes on the same
+///        host through a POSIX shared memory ring.
+///
+/// Every SharedMemoryTransport attached to the same segment name shares a
+/// single broadcast ring. Sent messages are serialized directly into a ring
+/// slot, and each attached transport has a receiver thread that parses them
+/// straight out of the ring and hands them to its local listeners. Listener
+/// matching and registration behave exactly as in LoopbackTransport.
+///
+/// Idle receivers sleep on a futex in the shared segment and are only woken
+/// when a new message has been committed, so they do not spin.
+///
+/// @remarks The ring is lossy in the same way as utils::CyclicQueue: when a
+///          receiver falls more than `slot_count` messages behind, the oldest
+///          messages are overwritten and counted by droppedCount().
+///
+/// @remarks A process that dies while writing a slot stalls receivers at
+///          that slot until a writer reaches it again a lap later and, after
+///          Config::stale_write_timeout, reclaims it.
+///
+/// @note Messages are delivered on the receiver thread, including those sent
+///       from this transport instance.
+///
+/// @note Linux only (requires shm_open and futex).
+class SharedMemoryTransport : public LoopbackTransport {
+public:
+	/// @brief Geometry and location of the shared memory ring.
+	struct Config {
+		/// @brief Name of the shared memory object (see shm_open). Must start
+		///        with a '/'.
+		std::string name;
+		/// @brief Number of slots in the ring. Must be a power of two.
+		///
+		/// @note Only used by the transport that creates the segment. Others
+		///       adopt the geometry of the existing segment.
+		uint32_t slot_count{1024};
+		/// @brief Maximum serialized UMessage size, in bytes.
+		///
+		/// @note Only used by the transport that creates the segment. Others
+		///       adopt the geometry of the existing segment.
+		uint32_t slot_size{16 * 1024};
+		/// @brief How long this transport's writers wait for a slot that
+		///        another writer is still filling before taking it over.
+		///
+		/// A writer that dies (or is stopped) mid-write leaves its slot
+		/// marked as in progress. Once this timeout has passed, that writer
+		/// is presumed dead and its message is treated as dropped. It must
+		/// be far longer than a healthy writer could take to serialize one
+		/// message, or a slow but live writer may corrupt its slot.
+		std::chrono::milliseconds stale_write_timeout{1000};
+	};
+
+	/// @brief Parts of the shared memory segment's layout, for inspecting a
+	///        ring from outside a transport (e.g. in tests). These only
+	///        change along with the ring's layout version.
+	struct Layout {
+		/// @brief Offset of the next sequence number to be claimed by a
+		///        writer, an atomic uint64_t.
+		static constexpr size_t WRITE_SEQ_OFFSET = 64;
+		/// @brief Size of the segment header. The first slot follows it, and
+		///        each slot starts with its state, an atomic uint64_t.
+		static constexpr size_t HEADER_SIZE = 192;
+
+		/// @brief Gets the slot state while a writer is filling the slot
+		///        for a sequence number.
+		static constexpr uint64_t writingState(uint64_t seq) {
+			return ((seq + 1) << 1) | 1;
+		}
+	};
+
+	/// @brief Constructor. Attaches to the named shared memory segment,
+	///        creating it if it does not already exist.
+	///
+	/// @param defaultSource Default Authority and Entity (as a UUri) for
+	///        clients using this transport instance.
+	/// @param config Shared memory ring configuration.
+	///
+	/// @throws InvalidUUri if the default source is not valid.
+	/// @throws std::invalid_argument if the configuration is not valid.
+	/// @throws std::system_error if the segment could not be created,
+	///         attached, or mapped.
+	SharedMemoryTransport(const v1::UUri& defaultSource, const Config& config);
+
+	/// @brief Stops the receiver thread and detaches from the segment.
+	///
+	/// @note The segment itself remains until remove() is called.
+	~SharedMemoryTransport() override;
+
+	/// @brief Removes a named shared memory segment.
+	///
+	/// Transports already attached to the segment continue to work, but new
+	/// transports using the name will create a new segment.
+	///
+	/// @returns True if the segment existed and was removed.
+	static bool remove(const std::string& name);
+
+	/// @brief Gets the number of messages this transport's receiver missed
+	///        because they were overwritten before they could be read.
+	[[nodiscard]] uint64_t droppedCount() const;
+
+	/// @brief Gets the largest serialized message size the ring can carry.
+	[[nodiscard]] uint32_t maxMessageSize() const;
+
+protected:
+	/// @brief Serializes the message into the next free slot of the ring.
+	///
+	/// @returns * OKSTATUS once the message has been committed to the ring.
+	///          * RESOURCE_EXHAUSTED if the serialized message is larger than
+	///            maxMessageSize().
+	[[nodiscard]] v1::UStatus sendImpl(const v1::UMessage& message) override;
+
+	/// @brief Serializes the messages into consecutive slots of the ring,
+	///        claiming the slots and waking receivers once per batch.
+	///
+	/// @returns One status per message, as for sendImpl().
+	[[nodiscard]] std::vector<v1::UStatus> sendBatchImpl(
+	    const v1::UMessage* messages, size_t count) override;
+
+private:
+	/// @brief Mapping of the ring along with the receiver thread state
+	struct Ring;
+	std::unique_ptr<Ring> ring_;
+};
+
+}  // namespace uprotocol::transport
+
+#endif  // UP_CPP_TRANSPORT_SHAREDMEMORYTRANSPORT_H
@@ -18,7 +18,11 @@
 #include <uprotocol/v1/uri.pb.h>
 #include <uprotocol/v1/ustatus.pb.h>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <vector>
 
 namespace uprotocol::transport {
 
@@ -59,11 +63,43 @@ public:
 	/// @see uprotocol::datamodel::validator::uri::InvalidUUri
 	explicit UTransport(const v1::UUri&);
 
+	/// @brief How send() validates messages before they are sent.
+	enum class ValidationPolicy {
+		/// @brief Every message must pass message::isValid().
+		ALWAYS,
+		/// @brief One message in every N (see setValidationPolicy()) must pass
+		///        message::isValid(). The others are sent unchecked. Useful
+		///        for catching bugs in high-rate senders at reduced cost.
+		SAMPLED,
+		/// @brief Messages are assumed to be well-formed, as when produced by
+		///        UMessageBuilder. Only the checks that can change between
+		///        build() and send() are made, i.e. that the message has not
+		///        expired.
+		TRUSTED,
+		/// @brief No validation
+		OFF
+	};
+
+	/// @brief Number of messages send() has validated or skipped since the
+	///        transport was created.
+	struct ValidationStats {
+		/// @brief Messages fully checked with message::isValid()
+		uint64_t validated{0};
+		/// @brief Messages sent without a full check
+		uint64_t skipped{0};
+		/// @brief Messages that failed a check and were not sent
+		uint64_t rejected{0};
+	};
+
 	/// @brief Send a message.
 	///
+	/// The message is validated according to the transport's
+	/// ValidationPolicy, which is ALWAYS unless changed with
+	/// setValidationPolicy().
+	///
 	/// @param message UMessage to be sent.
 	///
-	/// @throws InvalidUMessage if the message doesn't pass the isValid() check.
+	/// @throws InvalidUMessage if the message doesn't pass validation.
 	///
 	/// @see uprotocol::datamodel::validator::message::isValid()
 	/// @see uprotocol::datamodel::validator::message::InvalidUMessage
@@ -73,6 +109,55 @@ public:
 	///          * FAILSTATUS with the appropriate failure.
 	[[nodiscard]] v1::UStatus send(const v1::UMessage& message);
 
+	/// @brief Send a message, overriding the transport's ValidationPolicy for
+	///        this call only.
+	///
+	/// @see send(const v1::UMessage&)
+	[[nodiscard]] v1::UStatus send(const v1::UMessage& message,
+	                               ValidationPolicy policy);
+
+	/// @brief Send a batch of messages.
+	///
+	/// Every message in the batch is validated, according to the
+	/// transport's ValidationPolicy, before any of them are sent. The batch
+	/// is then handed to the transport in a single call so that
+	/// implementations able to coalesce writes can do so.
+	///
+	/// @param messages Pointer to the first UMessage to be sent.
+	/// @param count Number of messages to be sent.
+	///
+	/// @throws InvalidUMessage if any message doesn't pass validation. No
+	///         messages are sent in this case.
+	///
+	/// @returns One UStatus per message, in the same order as the messages,
+	///          with the same meaning as the status returned by send().
+	[[nodiscard]] std::vector<v1::UStatus> sendBatch(
+	    const v1::UMessage* messages, size_t count);
+
+	/// @brief Send a batch of messages.
+	///
+	/// @see sendBatch(const v1::UMessage*, size_t)
+	[[nodiscard]] std::vector<v1::UStatus> sendBatch(
+	    const std::vector<v1::UMessage>& messages);
+
+	/// @brief Sets the ValidationPolicy used by send().
+	///
+	/// @param policy New policy.
+	/// @param sample_interval For SAMPLED, validate one message in every
+	///                        sample_interval. Values below 1 are treated
+	///                        as 1. Ignored for other policies.
+	void setValidationPolicy(ValidationPolicy policy,
+	                         size_t sample_interval = DEFAULT_SAMPLE_INTERVAL);
+
+	/// @brief Gets the ValidationPolicy used by send().
+	[[nodiscard]] ValidationPolicy getValidationPolicy() const;
+
+	/// @brief Gets counts of messages validated and skipped by send().
+	[[nodiscard]] ValidationStats getValidationStats() const;
+
+	/// @brief Default sample interval for ValidationPolicy::SAMPLED
+	static constexpr size_t DEFAULT_SAMPLE_INTERVAL = 64;
+
 	/// @brief Callback function (void(const UMessage&))
 	using ListenCallback = typename CallbackConnection::Callback;
 
@@ -99,9 +184,9 @@ public:
 	///                      have been sent from. The callback will only be
 	///                      called for messages where the source matches.
 	///
-	/// @throws InvalidUUri if either UUri fails the isValid() check.
+	/// @throws InvalidUUri if either UUri fails the isValidFilter() check.
 	///
-	/// @see uprotocol::datamodel::validator::uri::isValid()
+	/// @see uprotocol::datamodel::validator::uri::isValidFilter()
 	/// @see uprotocol::datamodel::validator::uri::InvalidUUri
 	///
 	/// @returns * OKSTATUS and a connected ListenHandle if the listener
@@ -132,6 +217,20 @@ protected:
 	///          * FAILSTATUS with the appropriate failure.
 	[[nodiscard]] virtual v1::UStatus sendImpl(const v1::UMessage& message) = 0;
 
+	/// @brief Send a batch of messages.
+	///
+	/// The transport client library can optionally implement this if it is
+	/// able to send several messages more efficiently than one at a time.
+	///
+	/// @note The default implementation calls sendImpl() for each message.
+	///
+	/// @param messages Pointer to the first UMessage to be sent.
+	/// @param count Number of messages to be sent. Always at least 1.
+	///
+	/// @returns One UStatus per message, in the same order as the messages.
+	[[nodiscard]] virtual std::vector<v1::UStatus> sendBatchImpl(
+	    const v1::UMessage* messages, size_t count);
+
 	/// @brief Represents the callable end of a callback connection.
 	///
 	/// This is a shared_ptr wrapping a callbacks::Connection. The
@@ -175,9 +274,21 @@ protected:
 	virtual void cleanupListener(CallableConn listener);
 
 private:
+	/// @brief Validates a message according to a policy, throwing
+	///        InvalidUMessage if it does not pass.
+	void validate(const v1::UMessage& message, ValidationPolicy policy);
+
 	/// @brief Default source Authority and Entity for all clients using this
 	///        transport instance.
 	const v1::UUri defaultSource_;
+
+	std::atomic<ValidationPolicy> validationPolicy_{ValidationPolicy::ALWAYS};
+	std::atomic<size_t> sampleInterval_{DEFAULT_SAMPLE_INTERVAL};
+	std::atomic<uint64_t> sampleCounter_{0};
+
+	std::atomic<uint64_t> validatedCount_{0};
+	std::atomic<uint64_t> skippedCount_{0};
+	std::atomic<uint64_t> rejectedCount_{0};
 };
 
 }  // namespace uprotocol::transport
@@ -12,6 +12,7 @@
 #ifndef UP_CPP_UTILS_CYCLICQUEUE_H
 #define UP_CPP_UTILS_CYCLICQUEUE_H
 
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <queue>
@@ -56,6 +57,100 @@ private:
 	std::queue<T> queue_;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+// Implementation
+
+template <typename T>
+CyclicQueue<T>::CyclicQueue(const size_t max_size) : queueMaxSize_(max_size) {}
+
+template <typename T>
+void CyclicQueue<T>::push(T&& data) noexcept {
+	{
+		std::lock_guard lock(mutex_);
+		if (queue_.size() >= queueMaxSize_) {
+			queue_.pop();
+		}
+		queue_.push(std::move(data));
+	}
+	conditionVariable_.notify_one();
+}
+
+template <typename T>
+void CyclicQueue<T>::push(const T& data) noexcept {
+	T copy(data);
+	push(std::move(copy));
+}
+
+template <typename T>
+bool CyclicQueue<T>::isFull() const noexcept {
+	std::lock_guard lock(mutex_);
+	return queue_.size() >= queueMaxSize_;
+}
+
+template <typename T>
+bool CyclicQueue<T>::isEmpty() const noexcept {
+	std::lock_guard lock(mutex_);
+	return queue_.empty();
+}
+
+template <typename T>
+bool CyclicQueue<T>::pop(T& popped_value) noexcept {
+	std::unique_lock lock(mutex_);
+	conditionVariable_.wait(lock, [this]() { return !queue_.empty(); });
+	popped_value = std::move(queue_.front());
+	queue_.pop();
+	return true;
+}
+
+template <typename T>
+bool CyclicQueue<T>::tryPop(T& popped_value) noexcept {
+	std::lock_guard lock(mutex_);
+	if (queue_.empty()) {
+		return false;
+	}
+	popped_value = std::move(queue_.front());
+	queue_.pop();
+	return true;
+}
+
+template <typename T>
+bool CyclicQueue<T>::tryPopFor(T& popped_value,
+                               std::chrono::milliseconds limit) noexcept {
+	std::unique_lock lock(mutex_);
+	if (!conditionVariable_.wait_for(lock, limit,
+	                                 [this]() { return !queue_.empty(); })) {
+		return false;
+	}
+	popped_value = std::move(queue_.front());
+	queue_.pop();
+	return true;
+}
+
+template <typename T>
+bool CyclicQueue<T>::tryPopUntil(
+    T& popped_value, std::chrono::system_clock::time_point when) noexcept {
+	std::unique_lock lock(mutex_);
+	if (!conditionVariable_.wait_until(lock, when,
+	                                   [this]() { return !queue_.empty(); })) {
+		return false;
+	}
+	popped_value = std::move(queue_.front());
+	queue_.pop();
+	return true;
+}
+
+template <typename T>
+size_t CyclicQueue<T>::size() const noexcept {
+	std::lock_guard lock(mutex_);
+	return queue_.size();
+}
+
+template <typename T>
+void CyclicQueue<T>::clear() noexcept {
+	std::lock_guard lock(mutex_);
+	queue_ = {};
+}
+
 }  // namespace uprotocol::utils
 
 #endif  // UP_CPP_UTILS_CYCLICQUEUE_H
@@ -0,0 +1,505 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_FUTURE_H
+#define UP_CPP_UTILS_FUTURE_H
+
+#include <up-cpp/utils/ThreadPool.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace uprotocol::utils {
+
+template <typename T>
+class Future;
+
+namespace detail {
+
+/// @brief State shared between a Promise and its Future.
+///
+/// The value and the continuation are each written by one side only, and
+/// published with a single compare-exchange on status. Whichever side
+/// arrives second runs the continuation, so completing a Future that
+/// already has a continuation (or the reverse) takes no locks.
+template <typename T>
+struct FutureState {
+	enum Status : uint8_t { PENDING, HAS_VALUE, HAS_CONTINUATION };
+
+	/// @brief Called once with the value, or with nullopt if the promise
+	///        was broken.
+	using Continuation = std::function<void(std::optional<T>&&)>;
+
+	/// @brief Gets a state from the pool, or allocates one.
+	static FutureState* acquire();
+
+	/// @brief Drops a reference, returning the state to the pool if it was
+	///        the last one.
+	void release();
+
+	/// @brief Publishes the value (or nullopt for a broken promise).
+	void complete(std::optional<T>&& result);
+
+	/// @brief Publishes the continuation.
+	void setContinuation(Continuation&& fn);
+
+	std::atomic<uint8_t> status{PENDING};
+	/// @brief References held by Promise and Future instances
+	std::atomic<uint32_t> refs{0};
+	/// @brief Number of Promise instances referring to this state
+	std::atomic<uint32_t> promises{0};
+	std::atomic<bool> satisfied{false};
+	std::optional<T> value;
+	Continuation continuation;
+};
+
+/// @brief Free list of FutureStates, shared by all threads.
+///
+/// Most futures are completed and consumed on different threads, so a
+/// per-thread cache would mostly fill up on one side and stay empty on the
+/// other.
+template <typename T>
+class FutureStatePool {
+public:
+	/// @brief Largest number of idle states kept for reuse
+	static constexpr size_t MAX_IDLE = 1024;
+
+	static FutureStatePool& instance() {
+		// Never destroyed, so that states released during static
+		// destruction (e.g. from detached threads) are still valid.
+		static auto* pool = new FutureStatePool;
+		return *pool;
+	}
+
+	FutureState<T>* acquire() {
+		{
+			std::lock_guard lock(mutex_);
+			if (!idle_.empty()) {
+				auto* state = idle_.back();
+				idle_.pop_back();
+				return state;
+			}
+		}
+		return new FutureState<T>;
+	}
+
+	void release(FutureState<T>* state) {
+		state->status.store(FutureState<T>::PENDING,
+		                    std::memory_order_relaxed);
+		state->satisfied.store(false, std::memory_order_relaxed);
+		state->value.reset();
+		state->continuation = nullptr;
+
+		{
+			std::lock_guard lock(mutex_);
+			if (idle_.size() < MAX_IDLE) {
+				idle_.push_back(state);
+				return;
+			}
+		}
+		delete state;
+	}
+
+private:
+	FutureStatePool() { idle_.reserve(MAX_IDLE); }
+
+	std::mutex mutex_;
+	std::vector<FutureState<T>*> idle_;
+};
+
+/// @brief ThreadPool task that still runs, on whichever thread destroys it,
+///        if the pool discards it without running it (e.g. a full queue).
+template <typename Fn>
+class GuaranteedTask {
+public:
+	explicit GuaranteedTask(Fn&& fn) : fn_(std::move(fn)) {}
+
+	GuaranteedTask(GuaranteedTask&& other) noexcept {
+		if (other.fn_) {
+			fn_.emplace(std::move(*other.fn_));
+			other.fn_.reset();
+		}
+	}
+
+	~GuaranteedTask() {
+		if (fn_) {
+			(*fn_)();
+		}
+	}
+
+	GuaranteedTask(const GuaranteedTask&) = delete;
+	GuaranteedTask& operator=(const GuaranteedTask&) = delete;
+	GuaranteedTask& operator=(GuaranteedTask&&) = delete;
+
+	void operator()() {
+		Fn fn = std::move(*fn_);
+		fn_.reset();
+		fn();
+	}
+
+private:
+	std::optional<Fn> fn_;
+};
+
+}  // namespace detail
+
+/// @brief Producing half of a Future.
+///
+/// Lighter alternative to std::promise. Shared states are recycled through
+/// a pool, and completion is signalled with a single atomic operation
+/// instead of a mutex and condition variable.
+///
+/// Copies of a Promise refer to the same Future, and the first to set a
+/// value wins. If every copy is destroyed without a value being set, the
+/// promise is broken: Future::get() throws std::future_error and
+/// continuations are not called.
+template <typename T>
+class Promise {
+public:
+	Promise();
+	~Promise();
+
+	Promise(const Promise&);
+	Promise(Promise&&) noexcept;
+	Promise& operator=(const Promise&) = delete;
+	Promise& operator=(Promise&&) = delete;
+
+	/// @brief Gets the Future for this promise.
+	///
+	/// @throws std::future_error if the Future was already retrieved.
+	[[nodiscard]] Future<T> getFuture();
+
+	/// @brief Completes the Future. If a continuation has been attached, it
+	///        runs on this thread before setValue() returns.
+	///
+	/// @throws std::future_error if a value was already set.
+	void setValue(T&& value);
+
+private:
+	detail::FutureState<T>* state_;
+	bool future_retrieved_{false};
+};
+
+/// @brief Consuming half of a Promise.
+///
+/// Lighter alternative to std::future, with continuations. The result is
+/// consumed exactly once, either by get() or by then(). Afterwards, the
+/// Future is no longer valid().
+///
+/// There is no timed wait. Results that may never arrive should be given a
+/// deadline by the producer (e.g. RpcClient expires requests after their
+/// TTL).
+template <typename T>
+class Future {
+public:
+	/// @brief Constructs an invalid Future
+	Future() = default;
+	~Future();
+
+	Future(const Future&) = delete;
+	Future& operator=(const Future&) = delete;
+	Future(Future&&) noexcept;
+	Future& operator=(Future&&) noexcept;
+
+	/// @brief Checks if this Future refers to a result not yet consumed.
+	[[nodiscard]] bool valid() const { return state_ != nullptr; }
+
+	/// @brief Checks if the result is available without blocking.
+	[[nodiscard]] bool isReady() const;
+
+	/// @brief Waits for and consumes the result.
+	///
+	/// Blocking only costs a mutex and condition variable if the result is
+	/// not already available.
+	///
+	/// @throws std::future_error if this Future is not valid() or the
+	///         promise was broken.
+	T get();
+
+	/// @brief Consumes the result by calling fn with it once available.
+	///
+	/// fn runs immediately on this thread if the result is already
+	/// available, and otherwise on the thread that calls setValue(). It
+	/// must not throw.
+	///
+	/// @returns Nothing if fn returns void. Otherwise, a Future for the
+	///          value fn returns.
+	///
+	/// @throws std::future_error if this Future is not valid().
+	template <typename Fn>
+	auto then(Fn&& fn);
+
+	/// @brief Consumes the result by calling fn with it on an executor.
+	///
+	/// If the executor discards the task without running it (its queue is
+	/// full, or it is destroyed), fn is called on the thread that discarded
+	/// the task instead.
+	///
+	/// @returns As for then(Fn&&).
+	template <typename Fn>
+	auto then(ThreadPool& executor, Fn&& fn);
+
+private:
+	friend Promise<T>;
+
+	explicit Future(detail::FutureState<T>* state) : state_(state) {}
+
+	/// @brief Hands the state's continuation slot to fn and gives up this
+	///        Future's reference.
+	void consume(typename detail::FutureState<T>::Continuation&& fn);
+
+	detail::FutureState<T>* state_{nullptr};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation
+
+namespace detail {
+
+template <typename T>
+FutureState<T>* FutureState<T>::acquire() {
+	return FutureStatePool<T>::instance().acquire();
+}
+
+template <typename T>
+void FutureState<T>::release() {
+	if (refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		FutureStatePool<T>::instance().release(this);
+	}
+}
+
+template <typename T>
+void FutureState<T>::complete(std::optional<T>&& result) {
+	if (result) {
+		// emplace() rather than assignment, which T may not support
+		value.emplace(std::move(*result));
+	}
+	uint8_t expected = PENDING;
+	if (status.compare_exchange_strong(expected, HAS_VALUE,
+	                                   std::memory_order_acq_rel)) {
+		return;
+	}
+	// The continuation was published first
+	auto fn = std::move(continuation);
+	fn(std::move(value));
+}
+
+template <typename T>
+void FutureState<T>::setContinuation(Continuation&& fn) {
+	continuation = std::move(fn);
+	uint8_t expected = PENDING;
+	if (status.compare_exchange_strong(expected, HAS_CONTINUATION,
+	                                   std::memory_order_acq_rel)) {
+		return;
+	}
+	// The value was published first
+	auto ready = std::move(continuation);
+	ready(std::move(value));
+}
+
+}  // namespace detail
+
+template <typename T>
+Promise<T>::Promise() : state_(detail::FutureState<T>::acquire()) {
+	state_->refs.store(1, std::memory_order_relaxed);
+	state_->promises.store(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+Promise<T>::~Promise() {
+	if (state_ == nullptr) {
+		return;
+	}
+	if ((state_->promises.fetch_sub(1, std::memory_order_acq_rel) == 1) &&
+	    !state_->satisfied.exchange(true, std::memory_order_acq_rel)) {
+		// Broken promise
+		state_->complete(std::nullopt);
+	}
+	state_->release();
+}
+
+template <typename T>
+Promise<T>::Promise(const Promise& other)
+    : state_(other.state_), future_retrieved_(true) {
+	state_->refs.fetch_add(1, std::memory_order_relaxed);
+	state_->promises.fetch_add(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+Promise<T>::Promise(Promise&& other) noexcept
+    : state_(std::exchange(other.state_, nullptr)),
+      future_retrieved_(other.future_retrieved_) {}
+
+template <typename T>
+Future<T> Promise<T>::getFuture() {
+	if (state_ == nullptr) {
+		throw std::future_error(std::future_errc::no_state);
+	}
+	if (future_retrieved_) {
+		throw std::future_error(std::future_errc::future_already_retrieved);
+	}
+	future_retrieved_ = true;
+	state_->refs.fetch_add(1, std::memory_order_relaxed);
+	return Future<T>(state_);
+}
+
+template <typename T>
+void Promise<T>::setValue(T&& value) {
+	if ((state_ == nullptr) ||
+	    state_->satisfied.exchange(true, std::memory_order_acq_rel)) {
+		throw std::future_error(std::future_errc::promise_already_satisfied);
+	}
+	state_->complete(std::optional<T>(std::move(value)));
+}
+
+template <typename T>
+Future<T>::~Future() {
+	if (state_ != nullptr) {
+		state_->release();
+	}
+}
+
+template <typename T>
+Future<T>::Future(Future&& other) noexcept
+    : state_(std::exchange(other.state_, nullptr)) {}
+
+template <typename T>
+Future<T>& Future<T>::operator=(Future&& other) noexcept {
+	if (this != &other) {
+		if (state_ != nullptr) {
+			state_->release();
+		}
+		state_ = std::exchange(other.state_, nullptr);
+	}
+	return *this;
+}
+
+template <typename T>
+bool Future<T>::isReady() const {
+	return (state_ != nullptr) &&
+	       (state_->status.load(std::memory_order_acquire) ==
+	        detail::FutureState<T>::HAS_VALUE);
+}
+
+template <typename T>
+T Future<T>::get() {
+	if (state_ == nullptr) {
+		throw std::future_error(std::future_errc::no_state);
+	}
+
+	std::optional<T> result;
+	if (isReady()) {
+		// Fast path: no continuation, no locking
+		if (state_->value) {
+			result.emplace(std::move(*state_->value));
+		}
+		std::exchange(state_, nullptr)->release();
+	} else {
+		struct Waiter {
+			std::mutex mutex;
+			std::condition_variable ready;
+			bool done{false};
+			std::optional<T>* result;
+		} waiter{{}, {}, false, &result};
+		// The waiter outlives the continuation: get() cannot return until
+		// the continuation has released the mutex.
+		consume([w = &waiter](std::optional<T>&& value) {
+			std::lock_guard lock(w->mutex);
+			if (value) {
+				w->result->emplace(std::move(*value));
+			}
+			w->done = true;
+			w->ready.notify_one();
+		});
+		std::unique_lock lock(waiter.mutex);
+		waiter.ready.wait(lock, [&waiter]() { return waiter.done; });
+	}
+
+	if (!result) {
+		throw std::future_error(std::future_errc::broken_promise);
+	}
+	return std::move(*result);
+}
+
+template <typename T>
+template <typename Fn>
+auto Future<T>::then(Fn&& fn) {
+	if (state_ == nullptr) {
+		throw std::future_error(std::future_errc::no_state);
+	}
+
+	using R = std::invoke_result_t<Fn, T>;
+	if constexpr (std::is_void_v<R>) {
+		consume([fn = std::forward<Fn>(fn)](std::optional<T>&& value) mutable {
+			if (value) {
+				fn(std::move(*value));
+			}
+		});
+	} else {
+		Promise<R> next;
+		auto future = next.getFuture();
+		// A broken promise breaks the chain when next is dropped
+		consume([fn = std::forward<Fn>(fn), next = std::move(next)](
+		            std::optional<T>&& value) mutable {
+			if (value) {
+				next.setValue(fn(std::move(*value)));
+			}
+		});
+		return future;
+	}
+}
+
+template <typename T>
+template <typename Fn>
+auto Future<T>::then(ThreadPool& executor, Fn&& fn) {
+	// The std::futures returned by submit() do not block on destruction
+	using R = std::invoke_result_t<Fn, T>;
+	if constexpr (std::is_void_v<R>) {
+		then([&executor, fn = std::forward<Fn>(fn)](T value) mutable {
+			static_cast<void>(executor.submit(detail::GuaranteedTask(
+			    [fn = std::move(fn), value = std::move(value)]() mutable {
+				    fn(std::move(value));
+			    })));
+		});
+	} else {
+		Promise<R> next;
+		auto future = next.getFuture();
+		then([&executor, fn = std::forward<Fn>(fn),
+		      next = std::move(next)](T value) mutable {
+			static_cast<void>(executor.submit(detail::GuaranteedTask(
+			    [fn = std::move(fn), value = std::move(value),
+			     next = std::move(next)]() mutable {
+				    next.setValue(fn(std::move(value)));
+			    })));
+		});
+		return future;
+	}
+}
+
+template <typename T>
+void Future<T>::consume(typename detail::FutureState<T>::Continuation&& fn) {
+	auto* state = std::exchange(state_, nullptr);
+	state->setContinuation(std::move(fn));
+	state->release();
+}
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_FUTURE_H
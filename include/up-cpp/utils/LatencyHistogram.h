@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_LATENCYHISTOGRAM_H
+#define UP_CPP_UTILS_LATENCYHISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace uprotocol::utils {
+
+/// @brief Histogram of durations with power-of-two microsecond buckets.
+///
+/// Bucket 0 counts durations under 1us. Bucket i counts durations in
+/// [2^(i-1), 2^i) us. The last bucket also counts everything longer.
+///
+/// Recording is lock-free, so a histogram can be shared by any number of
+/// threads. Snapshots are not atomic as a whole: a snapshot taken while
+/// durations are being recorded may include a duration in one counter and
+/// not yet in another.
+class LatencyHistogram final {
+public:
+	static constexpr size_t NUM_BUCKETS = 32;
+
+	/// @brief Copy of a histogram's counters at one point in time
+	struct Snapshot {
+		/// @brief Number of durations recorded in each bucket
+		std::array<uint64_t, NUM_BUCKETS> buckets{};
+		/// @brief Number of durations recorded
+		uint64_t count{0};
+		/// @brief Sum of all durations recorded
+		std::chrono::nanoseconds total{0};
+		/// @brief Longest duration recorded
+		std::chrono::nanoseconds max{0};
+
+		/// @brief Gets the exclusive upper bound of a bucket. The last
+		///        bucket has no upper bound, so nanoseconds::max() is
+		///        returned for it.
+		static std::chrono::nanoseconds upperBound(size_t bucket);
+
+		/// @brief Gets the mean duration, or zero if nothing was recorded.
+		[[nodiscard]] std::chrono::nanoseconds mean() const;
+
+		/// @brief Estimates a percentile from the buckets.
+		///
+		/// @param fraction Percentile as a fraction in [0, 1], e.g. 0.99.
+		///
+		/// @returns The upper bound of the bucket holding the percentile,
+		///          capped at max. Zero if nothing was recorded.
+		[[nodiscard]] std::chrono::nanoseconds percentile(
+		    double fraction) const;
+	};
+
+	LatencyHistogram() = default;
+
+	LatencyHistogram(const LatencyHistogram&) = delete;
+	LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+	/// @brief Gets the bucket a duration is counted in
+	static size_t bucketOf(std::chrono::nanoseconds duration);
+
+	/// @brief Counts one duration. Negative durations count as zero.
+	void record(std::chrono::nanoseconds duration);
+
+	/// @brief Copies the current counters
+	[[nodiscard]] Snapshot snapshot() const;
+
+private:
+	std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets_{};
+	std::atomic<uint64_t> count_{0};
+	std::atomic<int64_t> total_ns_{0};
+	std::atomic<int64_t> max_ns_{0};
+};
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_LATENCYHISTOGRAM_H
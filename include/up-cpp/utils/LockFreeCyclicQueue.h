@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_LOCKFREECYCLICQUEUE_H
+#define UP_CPP_UTILS_LOCKFREECYCLICQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+namespace uprotocol::utils {
+
+/// @brief Lock-free multi-producer, multi-consumer variant of CyclicQueue.
+///
+/// Provides the same interface and semantics as CyclicQueue, including
+/// evicting the oldest entry to make room when pushing to a full queue, but
+/// push() and tryPop() never take a lock.
+///
+/// Entries are stored in a fixed ring of slots, each carrying a sequence
+/// number that tells producers and consumers whether the slot is ready for
+/// them. Producers and consumers each advance their own index with a CAS,
+/// and the two indices are kept on separate cache lines so that they do not
+/// contend with each other.
+///
+/// Consumers that block in pop() / tryPopFor() / tryPopUntil() spin briefly
+/// and then park on a condition variable. Producers only touch the condition
+/// variable when at least one consumer is parked.
+///
+/// @remarks size(), isEmpty() and isFull() are snapshots and may be stale by
+///          the time they return when other threads are using the queue.
+template <typename T>
+class LockFreeCyclicQueue final {
+public:
+	explicit LockFreeCyclicQueue(const size_t max_size);
+
+	LockFreeCyclicQueue(const LockFreeCyclicQueue&) = delete;
+	LockFreeCyclicQueue& operator=(const LockFreeCyclicQueue&) = delete;
+
+	~LockFreeCyclicQueue();
+
+	void push(T&& data) noexcept;
+	void push(const T& data) noexcept;
+
+	bool isFull() const noexcept;
+	bool isEmpty() const noexcept;
+
+	// Blocking pop()
+	bool pop(T& popped_value) noexcept;
+	// Non-blocking pop()
+	bool tryPop(T& popped_value) noexcept;
+	// Time-limited blocking pop()s
+	bool tryPopFor(T& popped_value, std::chrono::milliseconds limit) noexcept;
+	bool tryPopUntil(T& popped_value,
+	                 std::chrono::system_clock::time_point when) noexcept;
+
+	size_t size() const noexcept;
+
+	void clear() noexcept;
+
+	/// @brief Wakes every consumer blocked in pop(), tryPopFor() or
+	///        tryPopUntil(). From then on, blocking pops return false as soon
+	///        as the queue is empty instead of waiting. Entries can still be
+	///        pushed and popped.
+	void interrupt() noexcept;
+
+private:
+	static constexpr size_t CACHE_LINE_SIZE = 64;
+	/// @brief Number of failed tryPop() calls before a consumer parks.
+	static constexpr size_t SPIN_LIMIT = 64;
+
+	/// @brief A slot's sequence is 2 * pos while it is free for the producer
+	///        at index pos, and 2 * pos + 1 once that producer has filled it.
+	///        Doubling keeps the two apart even when there is only one slot,
+	///        where pos + 1 would also be the next lap's free value.
+	struct Slot {
+		std::atomic<size_t> sequence;
+		alignas(T) unsigned char storage[sizeof(T)];
+
+		T* value() noexcept {
+			return std::launder(reinterpret_cast<T*>(storage));
+		}
+	};
+
+	bool tryPush(T& data) noexcept;
+	void wakeConsumer() noexcept;
+
+	template <typename WaitFn>
+	bool popBlocking(T& popped_value, WaitFn&& wait) noexcept;
+
+	const size_t capacity_;
+	std::unique_ptr<Slot[]> slots_;
+
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_{0};
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_{0};
+
+	/// @brief Parking for idle consumers
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> parked_{0};
+	std::atomic<bool> interrupted_{false};
+	std::mutex park_mutex_;
+	std::condition_variable park_cv_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation
+
+template <typename T>
+LockFreeCyclicQueue<T>::LockFreeCyclicQueue(const size_t max_size)
+    : capacity_(max_size > 0 ? max_size : 1),
+      slots_(std::make_unique<Slot[]>(capacity_)) {
+	for (size_t i = 0; i < capacity_; ++i) {
+		slots_[i].sequence.store(2 * i, std::memory_order_relaxed);
+	}
+}
+
+template <typename T>
+LockFreeCyclicQueue<T>::~LockFreeCyclicQueue() {
+	clear();
+}
+
+template <typename T>
+bool LockFreeCyclicQueue<T>::tryPush(T& data) noexcept {
+	size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+	Slot* slot;
+	for (;;) {
+		slot = &slots_[pos % capacity_];
+		size_t seq = slot->sequence.load(std::memory_order_acquire);
+		auto diff =
+		    static_cast<intptr_t>(seq) - static_cast<intptr_t>(2 * pos);
+		if (diff == 0) {
+			if (enqueue_pos_.compare_exchange_weak(
+			        pos, pos + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			// The slot still holds the entry from the previous lap
+			return false;
+		} else {
+			pos = enqueue_pos_.load(std::memory_order_relaxed);
+		}
+	}
+
+	new (slot->storage) T(std::move(data));
+	slot->sequence.store(2 * pos + 1, std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+void LockFreeCyclicQueue<T>::push(T&& data) noexcept {
+	while (!tryPush(data)) {
+		// If the slot is only held up by a consumer that has claimed it but
+		// not finished with it, wait rather than evicting another entry.
+		T evicted;
+		if (!isFull() || !tryPop(evicted)) {
+			std::this_thread::yield();
+		}
+	}
+	wakeConsumer();
+}
+
+template <typename T>
+void LockFreeCyclicQueue<T>::push(const T& data) noexcept {
+	T copy(data);
+	push(std::move(copy));
+}
+
+template <typename T>
+void LockFreeCyclicQueue<T>::wakeConsumer() noexcept {
+	// Pairs with the fence in popBlocking(). Either the parked consumer sees
+	// the new entry when it re-checks, or we see it parked here.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (parked_.load(std::memory_order_relaxed) > 0) {
+		// Taking the lock ensures a consumer that is between its re-check and
+		// its wait does not miss the notification.
+		{ std::lock_guard lock(park_mutex_); }
+		park_cv_.notify_one();
+	}
+}
+
+template <typename T>
+bool LockFreeCyclicQueue<T>::tryPop(T& popped_value) noexcept {
+	size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+	Slot* slot;
+	for (;;) {
+		slot = &slots_[pos % capacity_];
+		size_t seq = slot->sequence.load(std::memory_order_acquire);
+		auto diff =
+		    static_cast<intptr_t>(seq) - static_cast<intptr_t>(2 * pos + 1);
+		if (diff == 0) {
+			if (dequeue_pos_.compare_exchange_weak(
+			        pos, pos + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		} else if (diff < 0) {
+			// Nothing has been pushed to this slot yet
+			return false;
+		} else {
+			pos = dequeue_pos_.load(std::memory_order_relaxed);
+		}
+	}
+
+	T* value = slot->value();
+	popped_value = std::move(*value);
+	value->~T();
+	slot->sequence.store(2 * (pos + capacity_), std::memory_order_release);
+	return true;
+}
+
+template <typename T>
+template <typename WaitFn>
+bool LockFreeCyclicQueue<T>::popBlocking(T& popped_value,
+                                         WaitFn&& wait) noexcept {
+	for (size_t spin = 0; spin < SPIN_LIMIT; ++spin) {
+		if (tryPop(popped_value)) {
+			return true;
+		}
+		std::this_thread::yield();
+	}
+
+	std::unique_lock lock(park_mutex_);
+	parked_.fetch_add(1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	bool popped = false;
+	while (!(popped = tryPop(popped_value))) {
+		// Checked with the lock held so that interrupt() cannot be missed
+		if (interrupted_.load(std::memory_order_relaxed)) {
+			break;
+		}
+		if (!wait(lock)) {
+			popped = tryPop(popped_value);
+			break;
+		}
+	}
+
+	parked_.fetch_sub(1, std::memory_order_relaxed);
+	return popped;
+}
+
+template <typename T>
+bool LockFreeCyclicQueue<T>::pop(T& popped_value) noexcept {
+	return popBlocking(popped_value, [this](std::unique_lock<std::mutex>& l) {
+		park_cv_.wait(l);
+		return true;
+	});
+}
+
+template <typename T>
+bool LockFreeCyclicQueue<T>::tryPopFor(
+    T& popped_value, std::chrono::milliseconds limit) noexcept {
+	return tryPopUntil(popped_value, std::chrono::system_clock::now() + limit);
+}
+
+template <typename T>
+bool LockFreeCyclicQueue<T>::tryPopUntil(
+    T& popped_value, std::chrono::system_clock::time_point when) noexcept {
+	if (tryPop(popped_value)) {
+		return true;
+	}
+	if (std::chrono::system_clock::now() >= when) {
+		return false;
+	}
+	return popBlocking(popped_value,
+	                   [this, when](std::unique_lock<std::mutex>& l) {
+		                   return park_cv_.wait_until(l, when) ==
+		                          std::cv_status::no_timeout;
+	                   });
+}
+
+template <typename T>
+void LockFreeCyclicQueue<T>::interrupt() noexcept {
+	interrupted_.store(true, std::memory_order_relaxed);
+	{ std::lock_guard lock(park_mutex_); }
+	park_cv_.notify_all();
+}
+
+template <typename T>
+bool LockFreeCyclicQueue<T>::isFull() const noexcept {
+	return size() >= capacity_;
+}
+
+template <typename T>
+bool LockFreeCyclicQueue<T>::isEmpty() const noexcept {
+	return size() == 0;
+}
+
+template <typename T>
+size_t LockFreeCyclicQueue<T>::size() const noexcept {
+	// Read the consumer index first so that the result can't underflow
+	size_t dequeued = dequeue_pos_.load(std::memory_order_acquire);
+	size_t enqueued = enqueue_pos_.load(std::memory_order_acquire);
+	size_t used = (enqueued > dequeued) ? (enqueued - dequeued) : 0;
+	return (used < capacity_) ? used : capacity_;
+}
+
+template <typename T>
+void LockFreeCyclicQueue<T>::clear() noexcept {
+	T discarded;
+	while (tryPop(discarded)) {
+	}
+}
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_LOCKFREECYCLICQUEUE_H
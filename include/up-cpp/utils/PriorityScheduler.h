@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_PRIORITYSCHEDULER_H
+#define UP_CPP_UTILS_PRIORITYSCHEDULER_H
+
+#include <uprotocol/v1/uattributes.pb.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace uprotocol::utils {
+
+/// @brief Multi-level queue that orders items by UPriority class.
+///
+/// Items are held in one FIFO queue per class. pop() chooses the class to
+/// take from according to the scheduling Policy:
+///
+///   * STRICT - Always the highest non-empty class. Lower classes only
+///     progress when all higher ones are empty.
+///   * WEIGHTED_FAIR - Weighted round robin. In each round, every class may
+///     release up to its weight in items, highest class first. A round ends
+///     when no non-empty class has any of its allowance left. Lower classes
+///     are never starved, and a class receives roughly
+///     weight / (sum of weights of busy classes) of the throughput.
+///
+/// UPRIORITY_UNSPECIFIED and out-of-range values are scheduled as CS1, the
+/// default class.
+///
+/// Per-class depth and wait time counters are kept so that the effect of
+/// scheduling can be observed.
+///
+/// @remarks This class is not thread-safe. It is intended to be embedded in
+///          a stage (e.g. transport::AsyncSender) that provides its own
+///          locking.
+template <typename T>
+class PriorityScheduler final {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	/// @brief How pop() chooses between classes
+	enum class Policy { STRICT, WEIGHTED_FAIR };
+
+	/// @brief Number of classes, indexed by UPriority value
+	static constexpr size_t NUM_CLASSES = v1::UPriority_ARRAYSIZE;
+
+	/// @brief Items each class may release per WEIGHTED_FAIR round, indexed
+	///        by UPriority value.
+	using Weights = std::array<uint32_t, NUM_CLASSES>;
+
+	/// @brief Default weights: each class gets twice the share of the class
+	///        below it.
+	static constexpr Weights DEFAULT_WEIGHTS{0, 1, 2, 4, 8, 16, 32, 64};
+
+	/// @brief Counters for a single class
+	struct ClassStats {
+		/// @brief Items currently queued
+		size_t depth{0};
+		/// @brief Items popped since construction
+		uint64_t dequeued{0};
+		/// @brief Items removed by dropOldest() since construction
+		uint64_t dropped{0};
+		/// @brief Total time popped items spent queued
+		std::chrono::nanoseconds total_wait{0};
+		/// @brief Longest time a popped item spent queued
+		std::chrono::nanoseconds max_wait{0};
+	};
+
+	/// @param policy How to choose between classes.
+	/// @param weights For WEIGHTED_FAIR, allowance per class. Weights below
+	///                1 are treated as 1.
+	explicit PriorityScheduler(Policy policy = Policy::STRICT,
+	                           const Weights& weights = DEFAULT_WEIGHTS);
+
+	/// @brief Maps a UPriority to the class it is scheduled in
+	static size_t classOf(v1::UPriority priority);
+
+	/// @brief Queues an item in the class for the given priority
+	void push(v1::UPriority priority, T&& item);
+
+	/// @brief Removes the next item according to the scheduling policy.
+	///
+	/// @returns False if there were no items queued.
+	bool pop(T& item);
+
+	/// @brief Removes the oldest item of the lowest non-empty class, if that
+	///        class is not higher than the class for max_priority.
+	///
+	/// @returns True if an item was removed.
+	bool dropOldest(v1::UPriority max_priority, T& item);
+
+	/// @brief Gets the total number of items queued
+	[[nodiscard]] size_t size() const { return size_; }
+
+	/// @brief Checks if there are no items queued
+	[[nodiscard]] bool empty() const { return size_ == 0; }
+
+	/// @brief Gets the counters for the class a priority is scheduled in
+	[[nodiscard]] ClassStats stats(v1::UPriority priority) const;
+
+	/// @brief Removes all items, calling fn on each, highest class first.
+	template <typename Fn>
+	void drain(Fn&& fn);
+
+private:
+	struct Entry {
+		T item;
+		Clock::time_point queued_at;
+	};
+
+	/// @brief Takes the front item of a class and updates its counters
+	void take(size_t cls, T& item);
+
+	/// @brief Chooses the class for the next WEIGHTED_FAIR pop
+	size_t nextFairClass();
+
+	const Policy policy_;
+	Weights weights_;
+	/// @brief Allowance remaining in the current WEIGHTED_FAIR round
+	Weights credits_{};
+	std::array<std::deque<Entry>, NUM_CLASSES> queues_;
+	std::array<ClassStats, NUM_CLASSES> stats_;
+	size_t size_{0};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation
+
+template <typename T>
+PriorityScheduler<T>::PriorityScheduler(Policy policy, const Weights& weights)
+    : policy_(policy), weights_(weights) {
+	for (auto& weight : weights_) {
+		weight = std::max<uint32_t>(weight, 1);
+	}
+	credits_ = weights_;
+}
+
+template <typename T>
+size_t PriorityScheduler<T>::classOf(v1::UPriority priority) {
+	if ((priority <= v1::UPriority::UPRIORITY_UNSPECIFIED) ||
+	    (priority > v1::UPriority_MAX)) {
+		return v1::UPriority::UPRIORITY_CS1;
+	}
+	return static_cast<size_t>(priority);
+}
+
+template <typename T>
+void PriorityScheduler<T>::push(v1::UPriority priority, T&& item) {
+	const size_t cls = classOf(priority);
+	queues_[cls].push_back(Entry{std::move(item), Clock::now()});
+	++stats_[cls].depth;
+	++size_;
+}
+
+template <typename T>
+bool PriorityScheduler<T>::pop(T& item) {
+	if (size_ == 0) {
+		return false;
+	}
+
+	if (policy_ == Policy::WEIGHTED_FAIR) {
+		take(nextFairClass(), item);
+		return true;
+	}
+
+	for (size_t cls = NUM_CLASSES; cls-- > 0;) {
+		if (!queues_[cls].empty()) {
+			take(cls, item);
+			return true;
+		}
+	}
+	return false;
+}
+
+template <typename T>
+bool PriorityScheduler<T>::dropOldest(v1::UPriority max_priority, T& item) {
+	const size_t max_cls = classOf(max_priority);
+	for (size_t cls = 0; cls <= max_cls; ++cls) {
+		auto& queue = queues_[cls];
+		if (!queue.empty()) {
+			item = std::move(queue.front().item);
+			queue.pop_front();
+			--stats_[cls].depth;
+			++stats_[cls].dropped;
+			--size_;
+			return true;
+		}
+	}
+	return false;
+}
+
+template <typename T>
+typename PriorityScheduler<T>::ClassStats PriorityScheduler<T>::stats(
+    v1::UPriority priority) const {
+	return stats_[classOf(priority)];
+}
+
+template <typename T>
+template <typename Fn>
+void PriorityScheduler<T>::drain(Fn&& fn) {
+	for (size_t cls = NUM_CLASSES; cls-- > 0;) {
+		auto& queue = queues_[cls];
+		for (auto& entry : queue) {
+			fn(std::move(entry.item));
+		}
+		size_ -= queue.size();
+		stats_[cls].depth = 0;
+		queue.clear();
+	}
+}
+
+template <typename T>
+void PriorityScheduler<T>::take(size_t cls, T& item) {
+	auto& queue = queues_[cls];
+	auto& stats = stats_[cls];
+
+	const auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(
+	    Clock::now() - queue.front().queued_at);
+	stats.total_wait += waited;
+	stats.max_wait = std::max(stats.max_wait, waited);
+	++stats.dequeued;
+	--stats.depth;
+
+	item = std::move(queue.front().item);
+	queue.pop_front();
+	--size_;
+}
+
+template <typename T>
+size_t PriorityScheduler<T>::nextFairClass() {
+	// At most two passes: if no busy class has credit left, the round is
+	// over and every class gets its allowance back.
+	for (int pass = 0; pass < 2; ++pass) {
+		for (size_t cls = NUM_CLASSES; cls-- > 0;) {
+			if (!queues_[cls].empty() && (credits_[cls] > 0)) {
+				--credits_[cls];
+				return cls;
+			}
+		}
+		credits_ = weights_;
+	}
+	// Unreachable while size_ > 0, since all weights are at least 1
+	return NUM_CLASSES - 1;
+}
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_PRIORITYSCHEDULER_H
@@ -12,29 +12,64 @@
 #ifndef UP_CPP_UTILS_THREADPOOL_H
 #define UP_CPP_UTILS_THREADPOOL_H
 
-#include <up-cpp/utils/CyclicQueue.h>
+#include <up-cpp/utils/LockFreeCyclicQueue.h>
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 
 namespace uprotocol::utils {
 
+/// @brief Pool of worker threads for running tasks asynchronously.
+///
+/// Two scheduling modes are available:
+///
+///   * SHARED_QUEUE - All tasks go through a single queue. Worker threads are
+///     started on demand as tasks are submitted, up to the maximum number of
+///     threads, and exit after being idle for task_timeout.
+///   * WORK_STEALING - Every worker owns a local deque. Tasks submitted from
+///     a worker thread go to that worker's deque, where they are run in LIFO
+///     order. Tasks submitted from other threads go to the shared queue. Idle
+///     workers take from the shared queue, then steal the oldest tasks from
+///     other workers' deques. All workers are started on construction and
+///     sleep while there is no work.
+///
+/// In both modes, queues are bounded by max_queue_size and behave like
+/// CyclicQueue: when full, the oldest queued task is discarded. The future
+/// for a discarded task reports std::future_errc::broken_promise.
 class ThreadPool {
 public:
+	/// @brief How submitted tasks are distributed to worker threads
+	enum class Scheduling { SHARED_QUEUE, WORK_STEALING };
+
 	ThreadPool(const ThreadPool&) = delete;
 	ThreadPool(ThreadPool&&) = delete;
 
 	ThreadPool& operator=(const ThreadPool&) = delete;
 	ThreadPool& operator=(ThreadPool&&) = delete;
 
+	/// @brief Constructor
+	///
+	/// @param max_queue_size Maximum number of tasks held in each queue.
+	/// @param max_num_of_threads Maximum number of worker threads.
+	/// @param task_timeout In SHARED_QUEUE mode, how long a worker waits for
+	///                     a task before exiting. In WORK_STEALING mode, how
+	///                     long an idle worker sleeps before checking for
+	///                     work again.
+	/// @param scheduling Scheduling mode for this pool.
 	ThreadPool(const size_t max_queue_size, const size_t max_num_of_threads,
-	           std::chrono::milliseconds task_timeout);
+	           std::chrono::milliseconds task_timeout,
+	           Scheduling scheduling = Scheduling::SHARED_QUEUE);
 
+	/// @brief Stops all workers once their current task completes. Tasks
+	///        that have not started are discarded.
 	~ThreadPool();
 
 	// Submit a function to be executed asynchronously by the pool
@@ -42,14 +77,56 @@ public:
 	auto submit(F&& f, Args&&... args) -> std::future<decltype(f(args...))>;
 
 private:
-	CyclicQueue<std::function<void()>> queue_;
-	bool terminate_;
+	using Task = std::function<void()>;
+
+	/// @brief Task deque owned by a single worker in WORK_STEALING mode
+	struct WorkerQueue {
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	void enqueue(Task&& task);
+
+	// SHARED_QUEUE mode
+	void startSharedWorker();
+	void sharedWorker();
+
+	// WORK_STEALING mode
+	void stealingWorker(size_t index);
+	bool popLocal(size_t index, Task& task);
+	bool steal(size_t thief, Task& task);
+	bool hasQueuedWork();
+	void wakeIdleWorker();
+
+	LockFreeCyclicQueue<Task> queue_;
+	std::atomic<bool> terminate_;
 	size_t maxNumOfThreads_;
 	std::atomic<std::size_t> numOfThreads_;
 	std::vector<std::future<void>> threads_;
 	std::mutex mutex_;
 	const std::chrono::milliseconds timeout_;
+
+	const Scheduling scheduling_;
+	const size_t maxQueueSize_;
+	std::vector<std::unique_ptr<WorkerQueue>> workerQueues_;
+	std::atomic<size_t> idleWorkers_{0};
+	std::mutex idleMutex_;
+	std::condition_variable idleCondition_;
 };
+
+template <typename F, typename... Args>
+auto ThreadPool::submit(F&& f, Args&&... args)
+    -> std::future<decltype(f(args...))> {
+	using ResultType = decltype(f(args...));
+
+	auto task = std::make_shared<std::packaged_task<ResultType()>>(
+	    std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+	auto future = task->get_future();
+
+	enqueue([task]() { (*task)(); });
+	return future;
+}
+
 }  // namespace uprotocol::utils
 
 #endif  // UP_CPP_UTILS_THREADPOOL_H
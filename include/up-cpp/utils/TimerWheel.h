@@ -0,0 +1,224 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_TIMERWHEEL_H
+#define UP_CPP_UTILS_TIMERWHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace uprotocol::utils {
+
+/// @brief Hierarchical hashed timer wheel.
+///
+/// Timers are placed in one of LEVELS wheels of SLOTS slots each. Level 0
+/// has one slot per tick; each level above covers SLOTS times the span of
+/// the level below. Timers further out are held in a coarse slot and
+/// cascaded down to finer levels as time advances. With the defaults, any
+/// delay up to 2^32 ticks can be scheduled.
+///
+/// Scheduling a timer is O(1). Advancing jumps straight to each tick that
+/// has timers to expire or cascade, skipping the ticks in between. Its cost
+/// is O(SLOTS * LEVELS) per such tick plus O(1) per expired or cascaded
+/// timer, independent of how many ticks pass or timers are pending.
+///
+/// There is no cancel operation. Owners that need one should look the
+/// value up when it expires and ignore it if it no longer applies
+/// (lazy cancellation).
+///
+/// @remarks This class is not thread-safe, and does not read any clock.
+///          Callers convert their time base to ticks and provide their own
+///          locking.
+template <typename T>
+class TimerWheel final {
+public:
+	using Tick = uint64_t;
+
+	static constexpr size_t SLOT_BITS = 8;
+	static constexpr size_t SLOTS = size_t{1} << SLOT_BITS;
+	static constexpr size_t LEVELS = 4;
+
+	/// @brief Longest delay that can be scheduled, in ticks. Longer delays
+	///        are clamped to this.
+	static constexpr Tick MAX_DELAY = (Tick{1} << (SLOT_BITS * LEVELS)) - 1;
+
+	/// @param now Tick to start the wheel at.
+	explicit TimerWheel(Tick now = 0) : now_(now) {}
+
+	/// @brief Schedules a value to expire a number of ticks from now.
+	///
+	/// A delay of 0 expires on the next call to advance().
+	void schedule(Tick delay, T&& value);
+
+	/// @brief Moves the wheel forward, expiring timers along the way.
+	///
+	/// @param now New current tick. Ignored if it is not after the current
+	///            tick.
+	/// @param on_expire Called with each value whose delay has passed.
+	template <typename Fn>
+	void advance(Tick now, Fn&& on_expire);
+
+	/// @brief Gets the earliest tick at which advance() has work to do,
+	///        either expiring timers or cascading them to a finer level.
+	///
+	/// Owners driving the wheel from a clock can sleep until this tick
+	/// instead of waking every tick.
+	///
+	/// @returns The tick, which is now() if timers are already due, or
+	///          std::nullopt if no timers are scheduled.
+	[[nodiscard]] std::optional<Tick> nextEvent() const;
+
+	/// @brief Gets the current tick.
+	[[nodiscard]] Tick now() const { return now_; }
+
+	/// @brief Gets the number of scheduled timers.
+	[[nodiscard]] size_t size() const { return size_; }
+
+	/// @brief Checks if no timers are scheduled.
+	[[nodiscard]] bool empty() const { return size_ == 0; }
+
+private:
+	struct Timer {
+		Tick expiry;
+		T value;
+	};
+
+	using Slot = std::vector<Timer>;
+
+	/// @brief Places a timer in the slot for its expiry tick.
+	void place(Timer&& timer);
+
+	/// @brief Index of the slot in a level that covers a tick
+	static size_t slotOf(Tick tick, size_t level) {
+		return (tick >> (SLOT_BITS * level)) & (SLOTS - 1);
+	}
+
+	Tick now_;
+	size_t size_{0};
+	std::array<std::array<Slot, SLOTS>, LEVELS> wheels_;
+	/// @brief Timers that were due when scheduled
+	Slot due_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation
+
+template <typename T>
+void TimerWheel<T>::schedule(Tick delay, T&& value) {
+	if (delay > MAX_DELAY) {
+		delay = MAX_DELAY;
+	}
+	++size_;
+	place(Timer{now_ + delay, std::move(value)});
+}
+
+template <typename T>
+void TimerWheel<T>::place(Timer&& timer) {
+	if (timer.expiry <= now_) {
+		due_.push_back(std::move(timer));
+		return;
+	}
+
+	// The lowest level whose current rotation still includes the expiry.
+	// Equivalently, the level of the highest bit group where the expiry
+	// differs from the current tick.
+	const Tick differing = timer.expiry ^ now_;
+	size_t level = 0;
+	while ((level + 1 < LEVELS) &&
+	       ((differing >> (SLOT_BITS * (level + 1))) != 0)) {
+		++level;
+	}
+	wheels_[level][slotOf(timer.expiry, level)].push_back(std::move(timer));
+}
+
+template <typename T>
+template <typename Fn>
+void TimerWheel<T>::advance(Tick now, Fn&& on_expire) {
+	auto expire = [this, &on_expire](Slot& slot) {
+		Slot expired;
+		expired.swap(slot);
+		size_ -= expired.size();
+		for (auto& timer : expired) {
+			on_expire(std::move(timer.value));
+		}
+	};
+
+	expire(due_);
+
+	while (now_ < now) {
+		const auto next = nextEvent();
+		if (!next || (*next > now)) {
+			// Nothing to cascade or expire on the way
+			now_ = now;
+			return;
+		}
+		now_ = *next;
+
+		// Entering a new rotation of a level brings the timers in the
+		// matching slot of the level above down to finer levels. Higher
+		// levels go first so that what they cascade into the current slot
+		// of a lower level is cascaded again.
+		size_t top = 0;
+		while ((top + 1 < LEVELS) && (slotOf(now_, top) == 0)) {
+			++top;
+		}
+		for (size_t level = top; level > 0; --level) {
+			Slot cascading;
+			cascading.swap(wheels_[level][slotOf(now_, level)]);
+			for (auto& timer : cascading) {
+				place(std::move(timer));
+			}
+		}
+
+		expire(wheels_[0][slotOf(now_, 0)]);
+		// Timers placed while cascading that are already due
+		expire(due_);
+	}
+}
+
+template <typename T>
+std::optional<typename TimerWheel<T>::Tick> TimerWheel<T>::nextEvent()
+    const {
+	if (size_ == 0) {
+		return std::nullopt;
+	}
+	if (!due_.empty()) {
+		return now_;
+	}
+
+	// Timers in a level are in slots after the current one, and are acted on
+	// when the tick reaches the start of their slot. Every event in a level
+	// comes before any in the levels above, so the first occupied slot found
+	// from the bottom up is the next event.
+	for (size_t level = 0; level < LEVELS; ++level) {
+		const size_t shift = SLOT_BITS * level;
+		const size_t current = slotOf(now_, level);
+		const Tick rotation_start =
+		    (now_ >> (shift + SLOT_BITS)) << (shift + SLOT_BITS);
+		// Delays clamped to MAX_DELAY can land in a top level slot at or
+		// before the current one, to be reached in its next rotation.
+		for (size_t i = 1; i <= SLOTS; ++i) {
+			if (!wheels_[level][(current + i) & (SLOTS - 1)].empty()) {
+				return rotation_start + (Tick{current + i} << shift);
+			}
+		}
+	}
+	return std::nullopt;
+}
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_TIMERWHEEL_H
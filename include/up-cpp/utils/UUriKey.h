@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_UURIKEY_H
+#define UP_CPP_UTILS_UURIKEY_H
+
+#include <uprotocol/v1/uri.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace uprotocol::utils {
+
+/// @brief Maps authority names to small integer IDs.
+///
+/// Each distinct name is assigned an ID the first time it is interned, and
+/// keeps it for the lifetime of the table. Names are never removed, so a
+/// table should only intern names from a bounded set, such as the filters
+/// registered with a UUriMatcher. Names seen in received messages can be
+/// looked up with find(), which never adds to the table. There is
+/// deliberately no process-wide table.
+///
+/// @remarks Thread safe. Lookups of names already in the table take a shared
+///          lock; only the first intern() of a new name takes it exclusively.
+class AuthorityTable {
+public:
+	using Id = uint32_t;
+
+	/// @brief ID of the empty (local) authority
+	static constexpr Id LOCAL = 0;
+	/// @brief ID of the "*" wildcard authority
+	static constexpr Id WILDCARD = 1;
+
+	AuthorityTable();
+
+	AuthorityTable(const AuthorityTable&) = delete;
+	AuthorityTable& operator=(const AuthorityTable&) = delete;
+
+	/// @brief Gets the ID for a name, adding the name if it is new.
+	Id intern(std::string_view name);
+
+	/// @brief Gets the ID for a name without adding it.
+	///
+	/// @returns The ID, or std::nullopt if the name has not been interned.
+	[[nodiscard]] std::optional<Id> find(std::string_view name) const;
+
+	/// @brief Gets the name for an ID.
+	///
+	/// @remarks The view remains valid for the lifetime of the table.
+	///
+	/// @throws std::out_of_range if the ID was not issued by this table.
+	[[nodiscard]] std::string_view name(Id id) const;
+
+	/// @brief Checks if an authority name contains a wildcard, using the same
+	///        rule as validator::uri::uses_wildcards().
+	///
+	/// @throws std::out_of_range if the ID was not issued by this table.
+	[[nodiscard]] bool hasWildcard(Id id) const;
+
+	/// @brief Number of names in the table, including the reserved LOCAL and
+	///        WILDCARD entries.
+	[[nodiscard]] size_t size() const;
+
+private:
+	struct Entry {
+		std::string name;
+		bool has_wildcard;
+	};
+
+	mutable std::shared_mutex mutex_;
+	// A deque keeps entries at stable addresses, so ids_ can key on views of
+	// the stored names.
+	std::deque<Entry> entries_;
+	std::unordered_map<std::string_view, Id> ids_;
+};
+
+/// @brief Compact value type identifying a UUri, for use as a key in hash
+///        tables, matchers and caches.
+///
+/// The authority name is interned in an AuthorityTable and the numeric
+/// fields are packed into a single word. The hash is computed once on
+/// construction, so hashing and comparing keys never touch the authority
+/// string.
+///
+/// Keys are only comparable when made with the same AuthorityTable.
+class UUriKey {
+public:
+	/// @brief Key for the local authority with all numeric fields zero
+	UUriKey() = default;
+
+	/// @throws std::invalid_argument if ue_version_major or resource_id is
+	///         outside the range allowed by the UUri spec.
+	UUriKey(const v1::UUri& uri, AuthorityTable& table);
+
+	[[nodiscard]] AuthorityTable::Id authority() const { return authority_; }
+	[[nodiscard]] uint32_t ueId() const {
+		return static_cast<uint32_t>(fields_ >> UE_ID_SHIFT);
+	}
+	[[nodiscard]] uint8_t version() const {
+		return static_cast<uint8_t>(fields_ >> VERSION_SHIFT);
+	}
+	[[nodiscard]] uint16_t resourceId() const {
+		return static_cast<uint16_t>(fields_);
+	}
+
+	/// @brief Precomputed hash of the key
+	[[nodiscard]] size_t hash() const { return hash_; }
+
+	/// @brief Checks if any field holds a wildcard value, using the same
+	///        rules as validator::uri::uses_wildcards().
+	[[nodiscard]] bool usesWildcards() const { return wildcards_ != 0; }
+
+	/// @brief Checks if this key, treated as a filter that may contain
+	///        wildcards, matches a concrete key.
+	[[nodiscard]] bool matches(const UUriKey& concrete) const;
+
+	/// @brief Converts back to a UUri.
+	///
+	/// @param table Table that the key was made with.
+	[[nodiscard]] v1::UUri toUUri(const AuthorityTable& table) const;
+
+	bool operator==(const UUriKey& other) const {
+		return (fields_ == other.fields_) && (authority_ == other.authority_);
+	}
+	bool operator!=(const UUriKey& other) const { return !(*this == other); }
+	bool operator<(const UUriKey& other) const {
+		return (authority_ != other.authority_) ? authority_ < other.authority_
+		                                        : fields_ < other.fields_;
+	}
+
+	/// @brief Hash functor for unordered containers
+	struct Hash {
+		size_t operator()(const UUriKey& key) const { return key.hash(); }
+	};
+
+private:
+	static constexpr uint64_t UE_ID_SHIFT = 32;
+	static constexpr uint64_t VERSION_SHIFT = 16;
+
+	/// @brief Bits set in wildcards_ for each field holding a wildcard
+	enum WildcardBits : uint8_t {
+		AUTHORITY_WILDCARD = 1 << 0,
+		SERVICE_WILDCARD = 1 << 1,
+		INSTANCE_WILDCARD = 1 << 2,
+		VERSION_WILDCARD = 1 << 3,
+		RESOURCE_WILDCARD = 1 << 4
+	};
+
+	// ue_id (32) | unused (8) | version (8) | resource_id (16)
+	uint64_t fields_{0};
+	size_t hash_{0};
+	AuthorityTable::Id authority_{AuthorityTable::LOCAL};
+	uint8_t wildcards_{0};
+};
+
+}  // namespace uprotocol::utils
+
+namespace std {
+template <>
+struct hash<uprotocol::utils::UUriKey> {
+	size_t operator()(const uprotocol::utils::UUriKey& key) const {
+		return key.hash();
+	}
+};
+}  // namespace std
+
+#endif  // UP_CPP_UTILS_UURIKEY_H
@@ -0,0 +1,309 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_UURIMATCHER_H
+#define UP_CPP_UTILS_UURIMATCHER_H
+
+#include <uprotocol/v1/uri.pb.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "up-cpp/utils/UUriKey.h"
+
+namespace uprotocol::utils {
+
+/// @brief Index of UUri filters (which may contain wildcards) for finding all
+///        the filters that match a given UUri.
+///
+/// Filters are compiled into a four level tree: authority -> ue_id ->
+/// version -> resource. Each level is a hash table, and wildcards are stored
+/// as ordinary keys holding the wildcard value. Looking up a UUri probes only
+/// the exact and wildcard branches at each level, so the cost of a lookup
+/// depends on the depth of the tree rather than the number of filters.
+///
+/// Authority names are interned in an AuthorityTable owned by the matcher,
+/// so the tree and the records used by erase() hold small integer IDs rather
+/// than strings. Only filter authorities are interned; authorities looked up
+/// in forEachMatch() never grow the table. Names stay interned after their
+/// filters are erased or cleared.
+///
+/// Wildcards follow the same rules as validator::uri::uses_wildcards():
+///
+///   * authority_name "*"
+///   * service ID (lower 16 bits of ue_id) 0xFFFF
+///   * service instance ID (upper 16 bits of ue_id) 0x0000
+///   * ue_version_major 0xFF
+///   * resource_id 0xFFFF
+///
+/// @remarks Not thread safe. Concurrent calls to the const methods are safe,
+///          but any modification requires exclusive access.
+///
+/// @tparam T Value stored with each filter (e.g. a listener callback).
+template <typename T>
+class UUriMatcher {
+public:
+	/// @brief Identifies a single inserted filter. Used to erase it later.
+	using Id = uint64_t;
+
+	UUriMatcher() = default;
+
+	UUriMatcher(const UUriMatcher&) = delete;
+	UUriMatcher& operator=(const UUriMatcher&) = delete;
+
+	/// @brief Adds a filter to the index.
+	///
+	/// The same filter can be inserted any number of times, and each is
+	/// treated as a separate entry.
+	///
+	/// @returns Id that can be used to erase this entry.
+	Id insert(const v1::UUri& filter, T value);
+
+	/// @brief Removes a previously inserted filter.
+	///
+	/// @returns True if the entry existed and was removed.
+	bool erase(Id id);
+
+	/// @brief Calls a function with the value of every filter that matches
+	///        the UUri.
+	///
+	/// @param uri Concrete UUri (i.e. without wildcards) to match.
+	/// @param fn Callable as fn(const T&).
+	///
+	/// @note The order in which matches are visited is not specified.
+	template <typename Fn>
+	void forEachMatch(const v1::UUri& uri, Fn&& fn) const;
+
+	/// @brief Gets the values of all filters that match the UUri.
+	[[nodiscard]] std::vector<T> match(const v1::UUri& uri) const;
+
+	/// @brief Gets the number of filters in the index.
+	[[nodiscard]] size_t size() const { return locations_.size(); }
+
+	/// @brief Checks if the index holds any filters.
+	[[nodiscard]] bool empty() const { return locations_.empty(); }
+
+	/// @brief Removes all filters from the index.
+	void clear();
+
+	static constexpr std::string_view WILDCARD_AUTHORITY = "*";
+	static constexpr uint32_t WILDCARD_SERVICE_ID = 0x0000FFFF;
+	static constexpr uint32_t WILDCARD_INSTANCE_ID = 0x00000000;
+	static constexpr uint32_t WILDCARD_VERSION = 0xFF;
+	static constexpr uint32_t WILDCARD_RESOURCE = 0xFFFF;
+
+private:
+	static constexpr uint32_t SERVICE_ID_MASK = 0x0000FFFF;
+	static constexpr uint32_t INSTANCE_ID_MASK = 0xFFFF0000;
+
+	struct Entry {
+		Id id;
+		T value;
+	};
+
+	using ResourceLevel = std::unordered_map<uint32_t, std::vector<Entry>>;
+	using VersionLevel = std::unordered_map<uint32_t, ResourceLevel>;
+	using EntityLevel = std::unordered_map<uint32_t, VersionLevel>;
+	using AuthorityLevel =
+	    std::unordered_map<AuthorityTable::Id, EntityLevel>;
+
+	/// @brief Path through the tree to an inserted entry
+	struct Location {
+		AuthorityTable::Id authority;
+		uint32_t ue_id;
+		uint32_t ue_version_major;
+		uint32_t resource_id;
+	};
+
+	template <typename Fn>
+	static void visitEntities(const EntityLevel& entities, const v1::UUri& uri,
+	                          Fn& fn);
+
+	template <typename Fn>
+	static void visitVersions(const VersionLevel& versions,
+	                          const v1::UUri& uri, Fn& fn);
+
+	template <typename Fn>
+	static void visitResources(const ResourceLevel& resources,
+	                           const v1::UUri& uri, Fn& fn);
+
+	/// @brief Looks up a key and, if it is not the wildcard key, also looks up
+	///        the wildcard key. Calls visit() with each node found.
+	template <typename Map, typename Key, typename Visit>
+	static void probe(const Map& level, const Key& key, const Key& wildcard,
+	                  Visit&& visit);
+
+	AuthorityTable authorities_;
+	AuthorityLevel root_;
+	std::unordered_map<Id, Location> locations_;
+	Id next_id_{0};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation
+
+template <typename T>
+typename UUriMatcher<T>::Id UUriMatcher<T>::insert(const v1::UUri& filter,
+                                                   T value) {
+	Id id = next_id_++;
+	const auto authority = authorities_.intern(filter.authority_name());
+	root_[authority][filter.ue_id()][filter.ue_version_major()]
+	     [filter.resource_id()]
+	         .push_back(Entry{id, std::move(value)});
+	locations_.emplace(id, Location{authority, filter.ue_id(),
+	                                filter.ue_version_major(),
+	                                filter.resource_id()});
+	return id;
+}
+
+template <typename T>
+bool UUriMatcher<T>::erase(Id id) {
+	auto location_entry = locations_.find(id);
+	if (location_entry == locations_.end()) {
+		return false;
+	}
+	const Location& location = location_entry->second;
+
+	// Every level along the path is guaranteed to exist since the location
+	// was recorded on insert, and empty levels are pruned on the way out.
+	auto authority = root_.find(location.authority);
+	auto entity = authority->second.find(location.ue_id);
+	auto version = entity->second.find(location.ue_version_major);
+	auto resource = version->second.find(location.resource_id);
+
+	auto& entries = resource->second;
+	entries.erase(std::find_if(
+	    entries.begin(), entries.end(),
+	    [id](const Entry& entry) { return entry.id == id; }));
+
+	if (entries.empty()) {
+		version->second.erase(resource);
+		if (version->second.empty()) {
+			entity->second.erase(version);
+			if (entity->second.empty()) {
+				authority->second.erase(entity);
+				if (authority->second.empty()) {
+					root_.erase(authority);
+				}
+			}
+		}
+	}
+
+	locations_.erase(location_entry);
+	return true;
+}
+
+template <typename T>
+template <typename Fn>
+void UUriMatcher<T>::forEachMatch(const v1::UUri& uri, Fn&& fn) const {
+	if (root_.empty()) {
+		return;
+	}
+
+	auto visit = [&uri, &fn](const EntityLevel& entities) {
+		visitEntities(entities, uri, fn);
+	};
+	if (auto authority = authorities_.find(uri.authority_name())) {
+		probe(root_, *authority, AuthorityTable::WILDCARD, visit);
+	} else {
+		// No filter names this authority, so only "*" filters can match
+		auto wild = root_.find(AuthorityTable::WILDCARD);
+		if (wild != root_.end()) {
+			visit(wild->second);
+		}
+	}
+}
+
+template <typename T>
+std::vector<T> UUriMatcher<T>::match(const v1::UUri& uri) const {
+	std::vector<T> matched;
+	forEachMatch(uri, [&matched](const T& value) { matched.push_back(value); });
+	return matched;
+}
+
+template <typename T>
+void UUriMatcher<T>::clear() {
+	root_.clear();
+	locations_.clear();
+}
+
+template <typename T>
+template <typename Fn>
+void UUriMatcher<T>::visitEntities(const EntityLevel& entities,
+                                   const v1::UUri& uri, Fn& fn) {
+	// A filter's ue_id can wildcard the service ID, the instance ID, or both,
+	// so there are up to four distinct keys that could match.
+	const uint32_t service = uri.ue_id() & SERVICE_ID_MASK;
+	const uint32_t instance = uri.ue_id() & INSTANCE_ID_MASK;
+	const uint32_t keys[] = {uri.ue_id(), instance | WILDCARD_SERVICE_ID,
+	                         WILDCARD_INSTANCE_ID | service,
+	                         WILDCARD_INSTANCE_ID | WILDCARD_SERVICE_ID};
+
+	for (size_t i = 0; i < std::size(keys); ++i) {
+		// Skip keys already probed (e.g. when the URI itself has an
+		// instance ID of 0)
+		if (std::find(keys, keys + i, keys[i]) != keys + i) {
+			continue;
+		}
+		auto versions = entities.find(keys[i]);
+		if (versions != entities.end()) {
+			visitVersions(versions->second, uri, fn);
+		}
+	}
+}
+
+template <typename T>
+template <typename Fn>
+void UUriMatcher<T>::visitVersions(const VersionLevel& versions,
+                                   const v1::UUri& uri, Fn& fn) {
+	probe(versions, uri.ue_version_major(), WILDCARD_VERSION,
+	      [&uri, &fn](const ResourceLevel& resources) {
+		      visitResources(resources, uri, fn);
+	      });
+}
+
+template <typename T>
+template <typename Fn>
+void UUriMatcher<T>::visitResources(const ResourceLevel& resources,
+                                    const v1::UUri& uri, Fn& fn) {
+	probe(resources, uri.resource_id(), WILDCARD_RESOURCE,
+	      [&fn](const std::vector<Entry>& entries) {
+		      for (const auto& entry : entries) {
+			      fn(entry.value);
+		      }
+	      });
+}
+
+template <typename T>
+template <typename Map, typename Key, typename Visit>
+void UUriMatcher<T>::probe(const Map& level, const Key& key,
+                           const Key& wildcard, Visit&& visit) {
+	auto exact = level.find(key);
+	if (exact != level.end()) {
+		visit(exact->second);
+	}
+	if (key != wildcard) {
+		auto wild = level.find(wildcard);
+		if (wild != level.end()) {
+			visit(wild->second);
+		}
+	}
+}
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_UURIMATCHER_H
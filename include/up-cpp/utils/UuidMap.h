@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_UTILS_UUIDMAP_H
+#define UP_CPP_UTILS_UUIDMAP_H
+
+#include <uprotocol/v1/uuid.pb.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace uprotocol::utils {
+
+/// @brief Hash table keyed on UUIDs, using open addressing.
+///
+/// Entries live in a single flat array with linear probing, so lookups touch
+/// one or two cache lines and inserts do not allocate unless the table
+/// grows. Removal uses backward-shift deletion, so there are no tombstones
+/// and probe lengths stay short under churn (e.g. as a table of in-flight
+/// requests).
+///
+/// The hash is the UUID's msb and lsb combined with a multiplicative mix.
+/// UUIDs are already mostly random or, for v8 UUIDs from UuidBuilder,
+/// unique in their timestamp and counter bits, so no further hashing is
+/// needed.
+///
+/// @remarks This class is not thread-safe.
+template <typename T>
+class UuidMap final {
+public:
+	/// @param capacity Number of entries to reserve space for.
+	explicit UuidMap(size_t capacity = 16);
+
+	/// @brief Adds an entry.
+	///
+	/// @returns False (and leaves the map unchanged) if the key is already
+	///          present.
+	bool insert(const v1::UUID& key, T&& value);
+
+	/// @brief Removes an entry, moving its value out.
+	///
+	/// @returns False if the key is not present.
+	bool take(const v1::UUID& key, T& value);
+
+	/// @brief Checks if a key is present.
+	[[nodiscard]] bool contains(const v1::UUID& key) const;
+
+	/// @brief Removes all entries, calling fn on each value.
+	template <typename Fn>
+	void drain(Fn&& fn);
+
+	/// @brief Gets the number of entries.
+	[[nodiscard]] size_t size() const { return size_; }
+
+	/// @brief Checks if there are no entries.
+	[[nodiscard]] bool empty() const { return size_ == 0; }
+
+private:
+	struct Slot {
+		uint64_t msb{0};
+		uint64_t lsb{0};
+		bool used{false};
+		T value{};
+	};
+
+	size_t indexOf(uint64_t msb, uint64_t lsb) const {
+		constexpr uint64_t GOLDEN_RATIO = 0x9E3779B97F4A7C15ULL;
+		return static_cast<size_t>(((msb ^ (lsb * GOLDEN_RATIO)) *
+		                            GOLDEN_RATIO) >>
+		                           shift_);
+	}
+
+	/// @brief Finds the slot holding a key.
+	///
+	/// @returns Index of the slot, or slots_.size() if not present.
+	size_t find(uint64_t msb, uint64_t lsb) const;
+
+	/// @brief Doubles the number of slots and reinserts every entry.
+	void grow();
+
+	std::vector<Slot> slots_;
+	size_t mask_;
+	/// @brief Shift that reduces a 64 bit hash to an index into slots_
+	unsigned shift_;
+	size_t size_{0};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Implementation
+
+template <typename T>
+UuidMap<T>::UuidMap(size_t capacity) {
+	// Kept at most half full
+	size_t slots = 16;
+	unsigned bits = 4;
+	while (slots < capacity * 2) {
+		slots <<= 1;
+		++bits;
+	}
+	slots_.resize(slots);
+	mask_ = slots - 1;
+	shift_ = 64 - bits;
+}
+
+template <typename T>
+bool UuidMap<T>::insert(const v1::UUID& key, T&& value) {
+	if ((size_ + 1) * 2 > slots_.size()) {
+		grow();
+	}
+
+	size_t index = indexOf(key.msb(), key.lsb());
+	while (slots_[index].used) {
+		if ((slots_[index].msb == key.msb()) &&
+		    (slots_[index].lsb == key.lsb())) {
+			return false;
+		}
+		index = (index + 1) & mask_;
+	}
+
+	auto& slot = slots_[index];
+	slot.msb = key.msb();
+	slot.lsb = key.lsb();
+	slot.used = true;
+	slot.value = std::move(value);
+	++size_;
+	return true;
+}
+
+template <typename T>
+bool UuidMap<T>::take(const v1::UUID& key, T& value) {
+	size_t index = find(key.msb(), key.lsb());
+	if (index == slots_.size()) {
+		return false;
+	}
+
+	value = std::move(slots_[index].value);
+	slots_[index].value = T{};
+	slots_[index].used = false;
+	--size_;
+
+	// Backward-shift deletion: pull later entries of the probe run into
+	// the gap if that brings them no further from their home slot.
+	size_t gap = index;
+	for (size_t next = (gap + 1) & mask_; slots_[next].used;
+	     next = (next + 1) & mask_) {
+		const size_t home = indexOf(slots_[next].msb, slots_[next].lsb);
+		// Distance from home to the gap is less than from home to next
+		if (((gap - home) & mask_) < ((next - home) & mask_)) {
+			slots_[gap] = std::move(slots_[next]);
+			slots_[next].value = T{};
+			slots_[next].used = false;
+			gap = next;
+		}
+	}
+	return true;
+}
+
+template <typename T>
+bool UuidMap<T>::contains(const v1::UUID& key) const {
+	return find(key.msb(), key.lsb()) != slots_.size();
+}
+
+template <typename T>
+template <typename Fn>
+void UuidMap<T>::drain(Fn&& fn) {
+	for (auto& slot : slots_) {
+		if (slot.used) {
+			slot.used = false;
+			T value = std::move(slot.value);
+			slot.value = T{};
+			fn(std::move(value));
+		}
+	}
+	size_ = 0;
+}
+
+template <typename T>
+size_t UuidMap<T>::find(uint64_t msb, uint64_t lsb) const {
+	for (size_t index = indexOf(msb, lsb); slots_[index].used;
+	     index = (index + 1) & mask_) {
+		if ((slots_[index].msb == msb) && (slots_[index].lsb == lsb)) {
+			return index;
+		}
+	}
+	return slots_.size();
+}
+
+template <typename T>
+void UuidMap<T>::grow() {
+	std::vector<Slot> old(slots_.size() * 2);
+	old.swap(slots_);
+	mask_ = slots_.size() - 1;
+	--shift_;
+
+	for (auto& slot : old) {
+		if (slot.used) {
+			size_t index = indexOf(slot.msb, slot.lsb);
+			while (slots_[index].used) {
+				index = (index + 1) & mask_;
+			}
+			slots_[index] = std::move(slot);
+		}
+	}
+}
+
+}  // namespace uprotocol::utils
+
+#endif  // UP_CPP_UTILS_UUIDMAP_H
@@ -10,3 +10,58 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "up-cpp/communication/Publisher.h"
+
+#include <stdexcept>
+
+namespace uprotocol::communication {
+using namespace uprotocol::datamodel::builder;
+
+Publisher::Publisher(std::shared_ptr<transport::UTransport> transport,
+                     const v1::UUri& topic, v1::UPayloadFormat format,
+                     std::optional<v1::UPriority> priority,
+                     std::optional<std::chrono::milliseconds> ttl)
+    : transport_(std::move(transport)),
+      publish_builder_(UMessageBuilder::publish(v1::UUri(topic))) {
+	if (!transport_) {
+		throw std::invalid_argument("Transport cannot be null");
+	}
+
+	publish_builder_.withPayloadFormat(format);
+
+	if (priority) {
+		publish_builder_.withPriority(*priority);
+	}
+
+	if (ttl) {
+		publish_builder_.withTtl(*ttl);
+	}
+}
+
+v1::UStatus Publisher::publish(Payload&& payload) const {
+	std::unique_lock lock(message_mutex_, std::try_to_lock);
+	if (!lock.owns_lock()) {
+		return transport_->send(publish_builder_.build(std::move(payload)));
+	}
+
+	publish_builder_.buildInto(message_, std::move(payload));
+	return transport_->send(message_);
+}
+
+std::vector<v1::UStatus> Publisher::publishBatch(
+    std::vector<Payload>&& payloads) const {
+	std::unique_lock lock(message_mutex_, std::try_to_lock);
+	std::vector<v1::UMessage> unshared;
+	auto& messages = lock.owns_lock() ? batch_ : unshared;
+
+	// Only grows, so that message storage is kept between batches
+	if (messages.size() < payloads.size()) {
+		messages.resize(payloads.size());
+	}
+	for (size_t i = 0; i < payloads.size(); ++i) {
+		publish_builder_.buildInto(messages[i], std::move(payloads[i]));
+	}
+
+	return transport_->sendBatch(messages.data(), payloads.size());
+}
+
+}  // namespace uprotocol::communication
@@ -10,3 +10,495 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "up-cpp/communication/RpcClient.h"
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "up-cpp/utils/TimerWheel.h"
+#include "up-cpp/utils/UuidMap.h"
+
+namespace uprotocol::communication {
+
+namespace {
+using MessageOrStatus = RpcClient::MessageOrStatus;
+using ErrorVariant = std::variant<v1::UStatus, RpcClient::Commstatus>;
+
+v1::UStatus makeStatus(v1::UCode code, const std::string& message) {
+	v1::UStatus status;
+	status.set_code(code);
+	status.set_message(message);
+	return status;
+}
+
+MessageOrStatus makeError(ErrorVariant&& error) {
+	return MessageOrStatus(utils::Unexpected<ErrorVariant>(std::move(error)));
+}
+
+datamodel::builder::UMessageBuilder makeRequestBuilder(
+    const std::shared_ptr<transport::UTransport>& transport,
+    const v1::UUri& method, v1::UPriority priority,
+    std::chrono::milliseconds ttl) {
+	if (!transport) {
+		throw std::invalid_argument("Transport cannot be null");
+	}
+	// Responses are addressed to the client's resource 0
+	v1::UUri source = transport->getDefaultSource();
+	source.set_resource_id(0);
+	return datamodel::builder::UMessageBuilder::request(
+	    v1::UUri(method), std::move(source), priority, ttl);
+}
+
+/// @brief Process-wide timer that expires RPC requests.
+///
+/// A single thread drives a utils::TimerWheel in ticks of TICK. The thread
+/// sleeps on a condition variable until the wheel's next event, or
+/// indefinitely while nothing is scheduled. Expiries of requests that have
+/// already completed stay in the wheel, so it is rarely empty; sleeping
+/// until the next event keeps the thread from waking every tick.
+class ExpiryTimer {
+public:
+	using Expiry = std::function<void()>;
+
+	static constexpr std::chrono::milliseconds TICK{1};
+
+	static ExpiryTimer& instance() {
+		static ExpiryTimer timer;
+		return timer;
+	}
+
+	/// @brief Calls expiry on the timer thread once delay has passed.
+	void schedule(std::chrono::milliseconds delay, Expiry&& expiry) {
+		bool sooner = false;
+		{
+			std::lock_guard lock(mutex_);
+			const auto now = currentTick();
+			if (wheel_.empty()) {
+				// Skip over the time spent idle
+				wheel_.advance(now, [](Expiry&&) {});
+			}
+			const auto next_event = wheel_.nextEvent();
+			// The current tick has partly elapsed, so round up a tick to
+			// never expire early
+			const auto expires_at = now + delay / TICK + 1;
+			wheel_.schedule(expires_at - wheel_.now(), std::move(expiry));
+			// The thread only needs waking if it is sleeping past the new
+			// next event
+			sooner = (wheel_.nextEvent() != next_event);
+		}
+		if (sooner) {
+			wake_.notify_one();
+		}
+	}
+
+	ExpiryTimer(const ExpiryTimer&) = delete;
+	ExpiryTimer& operator=(const ExpiryTimer&) = delete;
+
+	~ExpiryTimer() {
+		{
+			std::lock_guard lock(mutex_);
+			stop_ = true;
+		}
+		wake_.notify_all();
+		thread_.join();
+	}
+
+private:
+	using Wheel = utils::TimerWheel<Expiry>;
+
+	ExpiryTimer()
+	    : start_(std::chrono::steady_clock::now()),
+	      thread_([this]() { run(); }) {}
+
+	Wheel::Tick currentTick() const {
+		return static_cast<Wheel::Tick>(
+		    (std::chrono::steady_clock::now() - start_) / TICK);
+	}
+
+	void run() {
+		std::vector<Expiry> expired;
+		std::unique_lock lock(mutex_);
+		while (!stop_) {
+			const auto next_event = wheel_.nextEvent();
+			if (!next_event) {
+				wake_.wait(lock);
+				continue;
+			}
+			if (*next_event > currentTick()) {
+				// Stopping or a sooner expiry wakes the thread early, and
+				// the loop checks again
+				wake_.wait_until(
+				    lock, start_ + TICK * static_cast<int64_t>(*next_event));
+				continue;
+			}
+
+			wheel_.advance(currentTick(), [&expired](Expiry&& expiry) {
+				expired.push_back(std::move(expiry));
+			});
+			if (!expired.empty()) {
+				lock.unlock();
+				for (auto& expiry : expired) {
+					expiry();
+				}
+				expired.clear();
+				lock.lock();
+			}
+		}
+	}
+
+	const std::chrono::steady_clock::time_point start_;
+	std::mutex mutex_;
+	std::condition_variable wake_;
+	Wheel wheel_;
+	bool stop_{false};
+	std::thread thread_;
+};
+}  // namespace
+
+struct RpcClient::PendingRequests {
+	/// @brief Removes a request, moving its callback out.
+	///
+	/// @returns False if the request is no longer pending (i.e. it was
+	///          already completed, expired, or cancelled).
+	bool take(const v1::UUID& reqid, Callback& callback) {
+		std::lock_guard lock(mutex);
+		return requests.take(reqid, callback);
+	}
+
+	/// @brief Completes the request a response is for, if still pending.
+	void respond(const v1::UMessage& response) {
+		Callback callback;
+		if (!take(response.attributes().reqid(), callback)) {
+			// Late or duplicate
+			return;
+		}
+
+		const auto commstatus = response.attributes().commstatus();
+		if (commstatus != v1::UCode::OK) {
+			callback(makeError(Commstatus(commstatus)));
+		} else {
+			callback(MessageOrStatus(response));
+		}
+	}
+
+	std::mutex mutex;
+	utils::UuidMap<Callback> requests;
+};
+
+/// Routes are added when a request is sent, and removed when its response
+/// arrives or its TTL passes. Routes to clients that have since been
+/// destroyed are left in place until then, since their requests have already
+/// been cancelled.
+///
+/// The router can outlive every client using it, e.g. while the expiry
+/// timer is removing a route, so it holds its own reference to the transport
+/// that its listener is registered with. The listener only holds a raw
+/// pointer back to the router, so this does not form a cycle.
+class RpcClient::ResponseRouter {
+public:
+	/// @brief Gets the router for a transport, creating it and registering
+	///        its listener if no other client is using the transport.
+	///
+	/// @throws std::runtime_error if the listener could not be registered.
+	static std::shared_ptr<ResponseRouter> forTransport(
+	    const std::shared_ptr<transport::UTransport>& transport) {
+		static std::mutex registry_mutex;
+		static std::unordered_map<const transport::UTransport*,
+		                          std::weak_ptr<ResponseRouter>>
+		    registry;
+
+		std::lock_guard lock(registry_mutex);
+		for (auto it = registry.begin(); it != registry.end();) {
+			it = it->second.expired() ? registry.erase(it) : std::next(it);
+		}
+
+		auto& entry = registry[transport.get()];
+		if (auto router = entry.lock(); router) {
+			return router;
+		}
+
+		auto router = std::make_shared<ResponseRouter>(transport);
+		v1::UUri sink = transport->getDefaultSource();
+		sink.set_resource_id(0);
+		// The listener is disconnected before the router is destroyed, and
+		// disconnecting waits for running callbacks to return.
+		auto handle_or_status = transport->registerListener(
+		    sink, [raw_router = router.get()](const v1::UMessage& response) {
+			    raw_router->route(response);
+		    });
+		if (!handle_or_status) {
+			registry.erase(transport.get());
+			throw std::runtime_error(
+			    "Failed to register response listener | " +
+			    handle_or_status.error().message());
+		}
+		router->listener_ = std::move(handle_or_status).value();
+		entry = router;
+		return router;
+	}
+
+	explicit ResponseRouter(std::shared_ptr<transport::UTransport> transport)
+	    : transport_(std::move(transport)) {}
+
+	~ResponseRouter() { listener_.reset(); }
+
+	/// @brief Routes responses with a reqid to a client's pending requests
+	void add(const v1::UUID& reqid, std::weak_ptr<PendingRequests>&& pending) {
+		std::lock_guard lock(mutex_);
+		routes_.insert(reqid, std::move(pending));
+	}
+
+	/// @brief Stops routing responses with a reqid
+	void remove(const v1::UUID& reqid) {
+		std::weak_ptr<PendingRequests> discarded;
+		std::lock_guard lock(mutex_);
+		routes_.take(reqid, discarded);
+	}
+
+private:
+	void route(const v1::UMessage& response) {
+		// Notifications to this entity share the resource 0 sink
+		if (response.attributes().type() !=
+		    v1::UMessageType::UMESSAGE_TYPE_RESPONSE) {
+			return;
+		}
+
+		std::weak_ptr<PendingRequests> route;
+		{
+			std::lock_guard lock(mutex_);
+			if (!routes_.take(response.attributes().reqid(), route)) {
+				// Late, duplicate, or not from an RpcClient
+				return;
+			}
+		}
+		if (auto pending = route.lock(); pending) {
+			pending->respond(response);
+		}
+	}
+
+	std::mutex mutex_;
+	utils::UuidMap<std::weak_ptr<PendingRequests>> routes_;
+	/// @brief Keeps the transport alive until the listener is disconnected.
+	///        Also keeps the transport's address from being reused by
+	///        another transport while the registry maps it to this router.
+	std::shared_ptr<transport::UTransport> transport_;
+	transport::UTransport::ListenHandle listener_;
+};
+
+RpcClient::RpcClient(std::shared_ptr<transport::UTransport> transport,
+                     v1::UUri&& method, v1::UPriority priority,
+                     std::chrono::milliseconds ttl,
+                     std::optional<v1::UPayloadFormat> payload_format,
+                     std::optional<uint32_t> permission_level,
+                     std::optional<std::string> token)
+    : transport_(std::move(transport)),
+      builder_(makeRequestBuilder(transport_, method, priority, ttl)),
+      ttl_(ttl),
+      pending_(std::make_shared<PendingRequests>()),
+      router_(ResponseRouter::forTransport(transport_)) {
+	if (payload_format) {
+		builder_.withPayloadFormat(*payload_format);
+	}
+	if (permission_level) {
+		builder_.withPermissionLevel(*permission_level);
+	}
+	if (token) {
+		builder_.withToken(*token);
+	}
+}
+
+RpcClient::~RpcClient() {
+	std::vector<Callback> cancelled;
+	{
+		std::lock_guard lock(pending_->mutex);
+		pending_->requests.drain([&cancelled](Callback&& callback) {
+			cancelled.push_back(std::move(callback));
+		});
+	}
+	for (auto& callback : cancelled) {
+		callback(makeError(
+		    makeStatus(v1::UCode::CANCELLED, "RpcClient was destroyed")));
+	}
+}
+
+void RpcClient::invokeMethod(datamodel::builder::Payload&& payload,
+                             Callback&& callback) {
+	sendRequest(builder_.build(std::move(payload)), std::move(callback));
+}
+
+std::future<RpcClient::MessageOrStatus> RpcClient::invokeMethod(
+    datamodel::builder::Payload&& payload) {
+	auto promise = std::make_shared<std::promise<MessageOrStatus>>();
+	auto future = promise->get_future();
+
+	invokeMethod(std::move(payload), [promise](MessageOrStatus result) {
+		promise->set_value(std::move(result));
+	});
+
+	return future;
+}
+
+void RpcClient::invokeMethod(Callback&& callback) {
+	sendRequest(builder_.build(), std::move(callback));
+}
+
+std::future<RpcClient::MessageOrStatus> RpcClient::invokeMethod() {
+	auto promise = std::make_shared<std::promise<MessageOrStatus>>();
+	auto future = promise->get_future();
+
+	invokeMethod([promise](MessageOrStatus result) {
+		promise->set_value(std::move(result));
+	});
+
+	return future;
+}
+
+utils::Future<RpcClient::MessageOrStatus> RpcClient::invokeMethodPooled(
+    datamodel::builder::Payload&& payload) {
+	utils::Promise<MessageOrStatus> promise;
+	auto future = promise.getFuture();
+
+	invokeMethod(std::move(payload), [promise](MessageOrStatus result) mutable {
+		promise.setValue(std::move(result));
+	});
+
+	return future;
+}
+
+utils::Future<RpcClient::MessageOrStatus> RpcClient::invokeMethodPooled() {
+	utils::Promise<MessageOrStatus> promise;
+	auto future = promise.getFuture();
+
+	invokeMethod([promise](MessageOrStatus result) mutable {
+		promise.setValue(std::move(result));
+	});
+
+	return future;
+}
+
+#ifdef UP_CPP_ENABLE_COROUTINES
+RpcClient::InvokeAwaiter RpcClient::invokeMethodAsync(
+    datamodel::builder::Payload&& payload, utils::ThreadPool* executor) {
+	return InvokeAwaiter(*this, std::move(payload), executor);
+}
+
+RpcClient::InvokeAwaiter RpcClient::invokeMethodAsync(
+    utils::ThreadPool* executor) {
+	return InvokeAwaiter(*this, std::nullopt, executor);
+}
+
+namespace {
+/// @brief Resumes a coroutine from a ThreadPool task. If the pool discards
+///        the task without running it (a full queue, or the pool being
+///        destroyed), the coroutine is resumed by whoever discards it, rather
+///        than never resuming and leaking its frame.
+class ResumeTask {
+public:
+	explicit ResumeTask(std::coroutine_handle<> awaiting)
+	    : awaiting_(awaiting) {}
+
+	~ResumeTask() {
+		if (awaiting_) {
+			awaiting_.resume();
+		}
+	}
+
+	ResumeTask(const ResumeTask&) = delete;
+	ResumeTask& operator=(const ResumeTask&) = delete;
+
+	void operator()() { std::exchange(awaiting_, nullptr).resume(); }
+
+private:
+	std::coroutine_handle<> awaiting_;
+};
+}  // namespace
+
+bool RpcClient::InvokeAwaiter::await_suspend(
+    std::coroutine_handle<> awaiting) {
+	auto on_result = [this, awaiting](MessageOrStatus result) {
+		result_.emplace(std::move(result));
+		if (!done_.exchange(true, std::memory_order_acq_rel)) {
+			// Still inside await_suspend(), which will not suspend
+			return;
+		}
+		if (executor_ != nullptr) {
+			// The future does not block on destruction
+			auto resume = std::make_shared<ResumeTask>(awaiting);
+			static_cast<void>(executor_->submit([resume]() { (*resume)(); }));
+		} else {
+			awaiting.resume();
+		}
+	};
+
+	if (payload_) {
+		client_.invokeMethod(std::move(*payload_), std::move(on_result));
+	} else {
+		client_.invokeMethod(std::move(on_result));
+	}
+
+	// The awaiter must not be touched past this point if the callback has
+	// already resumed the coroutine.
+	return !done_.exchange(true, std::memory_order_acq_rel);
+}
+#endif
+
+void RpcClient::sendRequest(v1::UMessage&& request, Callback&& callback) {
+	const v1::UUID& reqid = request.attributes().id();
+
+	// Tracked before sending so that a response arriving on another thread
+	// before send() returns can be matched.
+	bool inserted = false;
+	{
+		std::lock_guard lock(pending_->mutex);
+		inserted = pending_->requests.insert(reqid, std::move(callback));
+	}
+	if (!inserted) {
+		// UUID counters freeze once exhausted within a millisecond, so IDs
+		// can repeat under very high request rates.
+		callback(makeError(makeStatus(v1::UCode::RESOURCE_EXHAUSTED,
+		                              "Request ID is already in use")));
+		return;
+	}
+
+	router_->add(reqid, pending_);
+
+	std::weak_ptr<PendingRequests> weak_pending = pending_;
+	std::weak_ptr<ResponseRouter> weak_router = router_;
+	ExpiryTimer::instance().schedule(
+	    ttl_, [weak_pending, weak_router, reqid = v1::UUID(reqid)]() {
+		    if (auto router = weak_router.lock(); router) {
+			    router->remove(reqid);
+		    }
+		    auto pending = weak_pending.lock();
+		    Callback expired;
+		    if (pending && pending->take(reqid, expired)) {
+			    expired(makeError(Commstatus(v1::UCode::DEADLINE_EXCEEDED)));
+		    }
+	    });
+
+	v1::UStatus status;
+	try {
+		status = transport_->send(request);
+	} catch (...) {
+		Callback discarded;
+		router_->remove(reqid);
+		pending_->take(reqid, discarded);
+		throw;
+	}
+
+	if (status.code() != v1::UCode::OK) {
+		router_->remove(reqid);
+		Callback failed;
+		if (pending_->take(reqid, failed)) {
+			failed(makeError(std::move(status)));
+		}
+	}
+}
+
+}  // namespace uprotocol::communication
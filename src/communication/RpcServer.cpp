@@ -10,3 +10,352 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "up-cpp/communication/RpcServer.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "up-cpp/datamodel/validator/UUri.h"
+#include "up-cpp/datamodel/validator/Uuid.h"
+
+namespace uprotocol::communication {
+
+namespace {
+using datamodel::builder::UMessageBuilder;
+namespace MessageValidator = datamodel::validator::message;
+namespace UriValidator = datamodel::validator::uri;
+namespace UuidValidator = datamodel::validator::uuid;
+
+/// @brief Checks if a request's TTL has passed since it was sent
+bool isExpired(const v1::UMessage& request) {
+	auto [expired, reason] = UuidValidator::isExpired(
+	    request.attributes().id(),
+	    std::chrono::milliseconds(request.attributes().ttl()));
+	return expired;
+}
+}  // namespace
+
+class RpcServer::Handler : public std::enable_shared_from_this<Handler> {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	Handler(std::shared_ptr<transport::UTransport> transport,
+	        RpcCallback&& callback, std::optional<v1::UPayloadFormat> format,
+	        std::optional<std::chrono::milliseconds> ttl,
+	        std::optional<Dispatch>&& dispatch)
+	    : transport_(std::move(transport)),
+	      callback_(std::move(callback)),
+	      format_(format),
+	      ttl_(ttl) {
+		if (dispatch) {
+			executor_ = std::move(dispatch->executor);
+			max_in_flight_ = dispatch->max_in_flight;
+		}
+	}
+
+	/// @brief Called on the transport's thread for every request received
+	void onRequest(const v1::UMessage& request) {
+		auto [valid, reason] = MessageValidator::isValidRpcRequest(request);
+		if (!valid) {
+			if (reason == MessageValidator::Reason::ID_EXPIRED) {
+				expired_.fetch_add(1, std::memory_order_relaxed);
+			}
+			return;
+		}
+
+		if (!acquireSlot()) {
+			rejected_.fetch_add(1, std::memory_order_relaxed);
+			sendError(request, v1::UCode::RESOURCE_EXHAUSTED);
+			return;
+		}
+
+		if (!executor_) {
+			SlotGuard slot(*this);
+			run(request);
+			return;
+		}
+
+		// The job is shared so that the slot is released even if the
+		// executor destroys the task without running it.
+		auto job = std::make_shared<Job>(shared_from_this(), request);
+		executor_([job]() {
+			job->ran = true;
+			auto& handler = *job->handler;
+			SlotGuard slot(handler);
+			handler.queue_wait_.record(Clock::now() - job->arrived);
+			if (isExpired(job->request)) {
+				handler.expired_.fetch_add(1, std::memory_order_relaxed);
+			} else {
+				handler.run(job->request);
+			}
+		});
+	}
+
+	/// @brief Stops calling the callback, then waits for running calls to
+	///        return.
+	void stop() {
+		std::unique_lock lock(mutex_);
+		stopped_ = true;
+		idle_.wait(lock, [this]() { return running_ == 0; });
+	}
+
+	[[nodiscard]] DispatchStats stats() const {
+		DispatchStats stats;
+		stats.handled = handled_.load(std::memory_order_relaxed);
+		stats.rejected = rejected_.load(std::memory_order_relaxed);
+		stats.expired = expired_.load(std::memory_order_relaxed);
+		stats.discarded = discarded_.load(std::memory_order_relaxed);
+		stats.send_failed = send_failed_.load(std::memory_order_relaxed);
+		stats.in_flight = in_flight_.load(std::memory_order_relaxed);
+		stats.queue_wait = queue_wait_.snapshot();
+		stats.handler_time = handler_time_.snapshot();
+		return stats;
+	}
+
+private:
+	/// @brief Releases an in-flight slot when it goes out of scope
+	class SlotGuard {
+	public:
+		explicit SlotGuard(Handler& handler) : handler_(handler) {}
+		~SlotGuard() { handler_.releaseSlot(); }
+
+		SlotGuard(const SlotGuard&) = delete;
+		SlotGuard& operator=(const SlotGuard&) = delete;
+
+	private:
+		Handler& handler_;
+	};
+
+	/// @brief Counts a call as running until it goes out of scope
+	class RunningGuard {
+	public:
+		explicit RunningGuard(Handler& handler) : handler_(handler) {}
+		~RunningGuard() {
+			std::lock_guard lock(handler_.mutex_);
+			if (--handler_.running_ == 0) {
+				handler_.idle_.notify_all();
+			}
+		}
+
+		RunningGuard(const RunningGuard&) = delete;
+		RunningGuard& operator=(const RunningGuard&) = delete;
+
+	private:
+		Handler& handler_;
+	};
+
+	/// @brief A request waiting on the executor
+	struct Job {
+		Job(std::shared_ptr<Handler>&& h, const v1::UMessage& r)
+		    : handler(std::move(h)), request(r), arrived(Clock::now()) {}
+
+		~Job() {
+			if (!ran) {
+				handler->discarded_.fetch_add(1, std::memory_order_relaxed);
+				handler->releaseSlot();
+			}
+		}
+
+		Job(const Job&) = delete;
+		Job& operator=(const Job&) = delete;
+
+		std::shared_ptr<Handler> handler;
+		v1::UMessage request;
+		Clock::time_point arrived;
+		bool ran{false};
+	};
+
+	/// @brief Reserves an in-flight slot, unless max_in_flight is reached.
+	bool acquireSlot() {
+		if (max_in_flight_ == 0) {
+			in_flight_.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+		auto current = in_flight_.load(std::memory_order_relaxed);
+		do {
+			if (current >= max_in_flight_) {
+				return false;
+			}
+		} while (!in_flight_.compare_exchange_weak(
+		    current, current + 1, std::memory_order_relaxed));
+		return true;
+	}
+
+	void releaseSlot() { in_flight_.fetch_sub(1, std::memory_order_relaxed); }
+
+	/// @brief Calls the callback and sends its response, unless stopped.
+	///        Never throws, so that it can run on any executor.
+	void run(const v1::UMessage& request) {
+		{
+			std::lock_guard lock(mutex_);
+			if (stopped_) {
+				return;
+			}
+			++running_;
+		}
+		RunningGuard running(*this);
+
+		handled_.fetch_add(1, std::memory_order_relaxed);
+		std::optional<v1::UMessage> response;
+		const auto start = Clock::now();
+		try {
+			response.emplace(buildResponse(request, callback_(request)));
+		} catch (...) {
+			// Neither a throwing callback nor a payload in the wrong format
+			// has a caller to be reported to, so the client is told instead.
+		}
+		handler_time_.record(Clock::now() - start);
+
+		if (response) {
+			send([&response]() { return std::move(*response); });
+		} else {
+			sendError(request, v1::UCode::INTERNAL);
+		}
+	}
+
+	v1::UMessage buildResponse(
+	    const v1::UMessage& request,
+	    std::optional<datamodel::builder::Payload>&& payload) const {
+		auto builder = UMessageBuilder::response(request);
+		if (ttl_) {
+			builder.withTtl(*ttl_);
+		}
+		if (format_) {
+			builder.withPayloadFormat(*format_);
+		}
+		return payload ? builder.build(std::move(*payload)) : builder.build();
+	}
+
+	void sendError(const v1::UMessage& request, v1::UCode code) {
+		send([this, &request, code]() {
+			auto builder = UMessageBuilder::response(request);
+			if (ttl_) {
+				builder.withTtl(*ttl_);
+			}
+			return builder.withCommStatus(code).build();
+		});
+	}
+
+	/// @brief Builds and sends a response, counting any failure. Never
+	///        throws: send() throws InvalidUMessage for e.g. a response
+	///        whose TTL passed while the callback ran, and there is no
+	///        caller to report it to.
+	template <typename Build>
+	void send(Build&& build) {
+		try {
+			if (transport_->send(build()).code() == v1::UCode::OK) {
+				return;
+			}
+		} catch (...) {
+		}
+		send_failed_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	std::shared_ptr<transport::UTransport> transport_;
+	RpcCallback callback_;
+	std::optional<v1::UPayloadFormat> format_;
+	std::optional<std::chrono::milliseconds> ttl_;
+	Dispatch::Executor executor_;
+	size_t max_in_flight_{0};
+
+	std::atomic<size_t> in_flight_{0};
+	std::atomic<uint64_t> handled_{0};
+	std::atomic<uint64_t> rejected_{0};
+	std::atomic<uint64_t> expired_{0};
+	std::atomic<uint64_t> discarded_{0};
+	std::atomic<uint64_t> send_failed_{0};
+	utils::LatencyHistogram queue_wait_;
+	utils::LatencyHistogram handler_time_;
+
+	std::mutex mutex_;
+	std::condition_variable idle_;
+	size_t running_{0};
+	bool stopped_{false};
+};
+
+RpcServer::Dispatch::Executor RpcServer::Dispatch::onThreadPool(
+    utils::ThreadPool& pool) {
+	return [&pool](std::function<void()>&& task) {
+		// Tasks report their own outcome; the future is not needed
+		static_cast<void>(pool.submit(std::move(task)));
+	};
+}
+
+RpcServer::ServerOrStatus RpcServer::create(
+    std::shared_ptr<transport::UTransport> transport,
+    const v1::UUri& method_name, RpcCallback&& callback,
+    std::optional<v1::UPayloadFormat> payload_format,
+    std::optional<std::chrono::milliseconds> ttl,
+    std::optional<Dispatch> dispatch) {
+	// The constructor is protected, so make_unique cannot be used
+	std::unique_ptr<RpcServer> server(new RpcServer(std::move(transport),
+	                                                method_name, payload_format,
+	                                                ttl, std::move(dispatch)));
+
+	auto status = server->connect(std::move(callback));
+	if (status.code() != v1::UCode::OK) {
+		return ServerOrStatus(utils::Unexpected<v1::UStatus>(status));
+	}
+	return ServerOrStatus(std::move(server));
+}
+
+RpcServer::RpcServer(std::shared_ptr<transport::UTransport> transport,
+                     const v1::UUri& method,
+                     std::optional<v1::UPayloadFormat> format,
+                     std::optional<std::chrono::milliseconds> ttl,
+                     std::optional<Dispatch> dispatch)
+    : transport_(std::move(transport)),
+      method_(method),
+      format_(format),
+      ttl_(ttl),
+      dispatch_(std::move(dispatch)) {
+	if (!transport_) {
+		throw std::invalid_argument("Transport cannot be null");
+	}
+
+	auto [valid, reason] = UriValidator::isValidRpcMethod(method_);
+	if (!valid) {
+		throw UriValidator::InvalidUUri(
+		    "Method URI is not a valid RPC method URI | " +
+		    std::string(UriValidator::message(*reason)));
+	}
+}
+
+RpcServer::~RpcServer() {
+	// Disconnecting waits for callbacks running on the transport's thread
+	callback_handle_.reset();
+	if (handler_) {
+		handler_->stop();
+	}
+}
+
+v1::UStatus RpcServer::connect(RpcCallback&& callback) {
+	handler_ = std::make_shared<Handler>(transport_, std::move(callback),
+	                                     format_, ttl_, std::move(dispatch_));
+
+	// The listener is disconnected before the handler is stopped, and
+	// queued jobs hold their own reference to the handler.
+	auto handle_or_status = transport_->registerListener(
+	    method_, [handler = handler_.get()](const v1::UMessage& request) {
+		    handler->onRequest(request);
+	    });
+	if (!handle_or_status) {
+		return handle_or_status.error();
+	}
+	callback_handle_ = std::move(handle_or_status).value();
+
+	v1::UStatus status;
+	status.set_code(v1::UCode::OK);
+	return status;
+}
+
+RpcServer::DispatchStats RpcServer::dispatchStats() const {
+	if (!handler_) {
+		return {};
+	}
+	return handler_->stats();
+}
+
+}  // namespace uprotocol::communication
@@ -10,6 +10,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "up-cpp/datamodel/builder/Payload.h"
+
+#include <utility>
+
 namespace uprotocol::datamodel::builder {
 
 // Byte vector constructor
@@ -46,17 +49,31 @@ Payload::Payload(Serialized&& serialized) {
 	payload_ = std::move(serialized);
 }
 
+// Shared Serialized constructor
+Payload::Payload(SharedSerialized shared) {
+	if (!shared) {
+		throw std::invalid_argument("Null shared payload");
+	}
+	if (!UPayloadFormat_IsValid(std::get<PayloadType::Format>(*shared))) {
+		throw std::out_of_range("Invalid Shared Serialized payload format");
+	}
+	shared_ = std::move(shared);
+}
+
 // Move constructor
 Payload::Payload(Payload&& other) noexcept
-    : payload_(std::move(other.payload_)), moved_(std::move(other.moved_)) {}
+    : payload_(std::move(other.payload_)),
+      shared_(std::move(other.shared_)),
+      moved_(std::move(other.moved_)) {}
 
 // Copy constructor
 Payload::Payload(const Payload& other)
-    : payload_(other.payload_), moved_(other.moved_) {}
+    : payload_(other.payload_), shared_(other.shared_), moved_(other.moved_) {}
 
 // Move assignment operator
 Payload& Payload::operator=(Payload&& other) noexcept {
 	payload_ = std::move(other.payload_);
+	shared_ = std::move(other.shared_);
 	moved_ = std::move(other.moved_);
 	return *this;
 }
@@ -64,6 +81,7 @@ Payload& Payload::operator=(Payload&& other) noexcept {
 // Copy assignment operator
 Payload& Payload::operator=(const Payload& other) {
 	payload_ = other.payload_;
+	shared_ = other.shared_;
 	moved_ = other.moved_;
 	return *this;
 }
@@ -94,7 +112,7 @@ Payload::PayloadMoved& Payload::PayloadMoved::operator=(
 	if (moved_) {
 		throw PayloadMoved("Payload has been already moved");
 	}
-	return payload_;
+	return shared_ ? *shared_ : payload_;
 }
 
 // buildMove method
@@ -105,6 +123,25 @@ Payload::PayloadMoved& Payload::PayloadMoved::operator=(
 	}
 	// Set payload_ to the "moved" state
 	moved_ = true;
+	if (shared_) {
+		// Other Payloads may still be using the shared data
+		return *std::exchange(shared_, nullptr);
+	}
 	return std::move(payload_);
 }
+
+// buildShared method
+[[nodiscard]] Payload::SharedSerialized Payload::buildShared() && {
+	if (moved_) {
+		throw PayloadMoved("Payload has been already moved");
+	}
+	moved_ = true;
+	if (shared_) {
+		return std::exchange(shared_, nullptr);
+	}
+	return std::make_shared<const Serialized>(std::move(payload_));
+}
+
+// isShared method
+[[nodiscard]] bool Payload::isShared() const { return shared_ != nullptr; }
 }  // namespace uprotocol::datamodel::builder
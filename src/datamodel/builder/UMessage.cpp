@@ -11,6 +11,11 @@
 
 #include "up-cpp/datamodel/builder/UMessage.h"
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+#include "up-cpp/datamodel/constants/UuidConstants.h"
 #include "up-cpp/datamodel/validator/UUri.h"
 #include "up-cpp/datamodel/validator/Uuid.h"
 
@@ -111,7 +116,7 @@ UMessageBuilder UMessageBuilder::response(v1::UUri&& sink,
 
 UMessageBuilder UMessageBuilder::response(const v1::UMessage& request) {
 	v1::UUri sink = request.attributes().source();
-	v1::UUID reqId = request.attributes().reqid();
+	v1::UUID reqId = request.attributes().id();
 	v1::UPriority priority = request.attributes().priority();
 	v1::UUri method = request.attributes().sink();
 
@@ -192,36 +197,168 @@ UMessageBuilder& UMessageBuilder::withPayloadFormat(v1::UPayloadFormat format) {
 	return *this;
 }
 
+struct UMessageBuilder::IdBlock {
+	explicit IdBlock(size_t size) : ids(size), next(size) {}
+
+	/// @brief Checks if the next ID can still be used at the given time.
+	///        The rest of a block is dropped once its millisecond tick has
+	///        passed, so that IDs do not go stale while a publisher is idle,
+	///        or once the counter froze because the reservation ran short.
+	[[nodiscard]] bool usable(uint64_t now_ms) const {
+		if (next >= ids.size()) {
+			return false;
+		}
+		const uint64_t block_ms = ids[0].msb() >> UUID_TIMESTAMP_SHIFT;
+		return (block_ms >= now_ms) &&
+		       ((next == 0) || (ids[next].msb() != ids[next - 1].msb()));
+	}
+
+	std::mutex mutex;
+	std::vector<v1::UUID> ids;
+	/// @brief Index of the next unused ID. Starts exhausted so that the
+	///        block is reserved when the first message is built.
+	size_t next;
+};
+
+UMessageBuilder& UMessageBuilder::withIdPrefetch(size_t block_size) {
+	if (block_size == 0) {
+		idBlock_.reset();
+	} else {
+		// More IDs than the counter can number in one tick would repeat
+		idBlock_ = std::make_shared<IdBlock>(
+		    std::min<size_t>(block_size, UUID_COUNTER_MASK + 1));
+	}
+
+	return *this;
+}
+
+v1::UUID UMessageBuilder::nextId() const {
+	if (!idBlock_) {
+		return uuidBuilder_.build();
+	}
+
+	const auto now_ms = static_cast<uint64_t>(
+	    std::chrono::time_point_cast<std::chrono::milliseconds>(
+	        std::chrono::system_clock::now())
+	        .time_since_epoch()
+	        .count());
+
+	std::lock_guard lock(idBlock_->mutex);
+	auto& ids = idBlock_->ids;
+	if (!idBlock_->usable(now_ms)) {
+		uuidBuilder_.buildBatch(ids.data(), ids.size());
+		idBlock_->next = 0;
+	}
+	return ids[idBlock_->next++];
+}
+
 v1::UMessage UMessageBuilder::build() const {
 	v1::UMessage message;
+	buildInto(message);
+
+	return message;
+}
+
+v1::UMessage UMessageBuilder::build(builder::Payload&& payload) const {
+	v1::UMessage message;
+	buildInto(message, std::move(payload));
+
+	return message;
+}
+
+v1::UMessage* UMessageBuilder::build(google::protobuf::Arena& arena) const {
+	auto* message = google::protobuf::Arena::CreateMessage<v1::UMessage>(&arena);
+	buildInto(*message);
+
+	return message;
+}
+
+v1::UMessage* UMessageBuilder::build(google::protobuf::Arena& arena,
+                                     builder::Payload&& payload) const {
+	auto* message = google::protobuf::Arena::CreateMessage<v1::UMessage>(&arena);
+	buildInto(*message, std::move(payload));
+
+	return message;
+}
+
+void UMessageBuilder::buildInto(v1::UMessage& message) const {
 	if (expectedPayloadFormat_.has_value()) {
 		throw UnexpectedFormat(
 		    "Tried to build with no payload when a payload format has been set "
 		    "using withPayloadFormat()");
 	}
 
-	*message.mutable_attributes() = attributes_;
-	*(message.mutable_attributes()->mutable_id()) = uuidBuilder_.build();
-
-	return message;
+	writeAttributes(*message.mutable_attributes());
+	message.clear_payload();
 }
 
-v1::UMessage UMessageBuilder::build(builder::Payload&& payload) const {
-	v1::UMessage message;
-
-	*message.mutable_attributes() = attributes_;
-	*(message.mutable_attributes()->mutable_id()) = uuidBuilder_.build();
-	auto [payloadData, payloadFormat] = std::move(payload).buildMove();
+void UMessageBuilder::buildInto(v1::UMessage& message,
+                                builder::Payload&& payload) const {
+	const auto payloadFormat =
+	    std::get<Payload::PayloadType::Format>(payload.buildCopy());
 	if (expectedPayloadFormat_.has_value()) {
 		if (payloadFormat != expectedPayloadFormat_) {
 			throw UnexpectedFormat(
 			    "Payload format does not match the expected format");
 		}
 	}
-	*message.mutable_payload() = std::move(payloadData);
+
+	writeAttributes(*message.mutable_attributes());
 	message.mutable_attributes()->set_payload_format(payloadFormat);
+	if (payload.isShared()) {
+		// Copy into the existing buffer rather than a temporary string
+		message.set_payload(
+		    std::get<Payload::PayloadType::Data>(payload.buildCopy()));
+		(void)std::move(payload).buildShared();
+	} else {
+		auto [payloadData, _] = std::move(payload).buildMove();
+		message.set_payload(std::move(payloadData));
+	}
+}
 
-	return message;
+void UMessageBuilder::writeAttributes(v1::UAttributes& attributes) const {
+	// Assigning attributes_ as a whole would Clear() the destination first,
+	// which frees its sub-messages. Writing field by field keeps them.
+	*attributes.mutable_id() = nextId();
+	attributes.set_type(attributes_.type());
+	attributes.mutable_source()->CopyFrom(attributes_.source());
+	if (attributes_.has_sink()) {
+		attributes.mutable_sink()->CopyFrom(attributes_.sink());
+	} else {
+		attributes.clear_sink();
+	}
+	attributes.set_priority(attributes_.priority());
+	if (attributes_.has_ttl()) {
+		attributes.set_ttl(attributes_.ttl());
+	} else {
+		attributes.clear_ttl();
+	}
+	if (attributes_.has_permission_level()) {
+		attributes.set_permission_level(attributes_.permission_level());
+	} else {
+		attributes.clear_permission_level();
+	}
+	if (attributes_.has_commstatus()) {
+		attributes.set_commstatus(attributes_.commstatus());
+	} else {
+		attributes.clear_commstatus();
+	}
+	if (attributes_.has_reqid()) {
+		attributes.mutable_reqid()->CopyFrom(attributes_.reqid());
+	} else {
+		attributes.clear_reqid();
+	}
+	if (attributes_.has_token()) {
+		attributes.set_token(attributes_.token());
+	} else {
+		attributes.clear_token();
+	}
+	if (attributes_.has_traceparent()) {
+		attributes.set_traceparent(attributes_.traceparent());
+	} else {
+		attributes.clear_traceparent();
+	}
+	attributes.set_payload_format(attributes_.payload_format());
 }
 
 UMessageBuilder::UMessageBuilder(v1::UMessageType msgType, v1::UUri&& source,
@@ -11,6 +11,9 @@
 
 #include "up-cpp/datamodel/builder/Uuid.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <random>
 #include <stdexcept>
 
@@ -18,14 +21,44 @@
 
 namespace uprotocol::datamodel::builder {
 
+namespace {
+/// @brief Number of bits used by the counter in UuidSharedState::ts_counter
+constexpr uint64_t COUNTER_BITS = 12;
+constexpr uint64_t COUNTER_MAX = UUID_COUNTER_MASK;
+/// @brief ts_counter value before the first UUID has been built
+constexpr uint64_t NO_TIMESTAMP = ~uint64_t{0};
+/// @brief Largest step back in time, in ms, that continues from the last
+///        timestamp used. Anything further is treated as the clock having
+///        been set back, and the new time is used as-is. Kept small because
+///        continuing puts UUIDs ahead of the clock, and validators reject
+///        UUIDs from the future.
+constexpr uint64_t MAX_CLOCK_REGRESSION_MS = 1;
+
+/// @brief Fills in a UUID from a packed (timestamp, counter) value
+void setUuid(v1::UUID& uuid, uint64_t ts_counter, uint64_t rand_b) {
+	uint64_t msb = (ts_counter >> COUNTER_BITS) << UUID_TIMESTAMP_SHIFT;
+	msb |= static_cast<uint64_t>(8)
+	       << UUID_VERSION_SHIFT;  // Set the version to 8
+	msb |= ts_counter & COUNTER_MAX;
+
+	// set the Variant to 10b
+	uint64_t lsb = rand_b | (static_cast<uint64_t>(UUID_VARIANT_RFC4122)
+	                         << UUID_VARIANT_SHIFT);
+
+	uuid.set_msb(msb);
+	uuid.set_lsb(lsb);
+}
+}  // namespace
+
+/// @brief State shared between builders, safe for concurrent use.
+///
+/// The timestamp and counter are packed into a single word so that build()
+/// can claim a unique (timestamp, counter) pair with one CAS and no lock.
 struct UuidBuilder::UuidSharedState {
-	std::mt19937_64 random_engine{std::random_device{}()};
-	uint16_t counter{0};
-	std::chrono::time_point<std::chrono::system_clock,
-	                        std::chrono::milliseconds>
-	    last_unix_ts_ms{};
+	/// @brief (unix_ts_ms << COUNTER_BITS) | counter
+	std::atomic<uint64_t> ts_counter{NO_TIMESTAMP};
+	std::once_flag rand_b_once;
 	uint64_t rand_b{0};
-	bool rand_b_initialized{false};
 };
 
 UuidBuilder UuidBuilder::getBuilder() { return UuidBuilder(false); }
@@ -63,45 +96,83 @@ UuidBuilder& UuidBuilder::withIndependentState() {
 
 v1::UUID UuidBuilder::build() {
 	v1::UUID uuid;
-	auto now = time_source_ ? time_source_() : std::chrono::system_clock::now();
-	auto unix_ts_ms =
-	    std::chrono::time_point_cast<std::chrono::milliseconds>(now);
-
-	if (unix_ts_ms != shared_state_->last_unix_ts_ms) {
-		// Reset the counter if the timestamp tick has changed
-		shared_state_->counter = 0;
-		shared_state_->last_unix_ts_ms = unix_ts_ms;
-	}
+	setUuid(uuid, reserve(1), randB());
+	return uuid;
+}
 
-	uint64_t msb = static_cast<uint64_t>(unix_ts_ms.time_since_epoch().count())
-	               << UUID_TIMESTAMP_SHIFT;
-	msb |= static_cast<uint64_t>(8)
-	       << UUID_VERSION_SHIFT;  // Set the version to 8
+std::vector<v1::UUID> UuidBuilder::buildBatch(size_t count) {
+	std::vector<v1::UUID> uuids(count);
+	buildBatch(uuids.data(), count);
+	return uuids;
+}
 
-	if (shared_state_->counter == 4095) {
-		// Counter has reached maximum value, freeze it
-		msb |= shared_state_->counter;
-	} else {
-		msb |= shared_state_->counter++;
+void UuidBuilder::buildBatch(v1::UUID* uuids, size_t count) {
+	if (count == 0) {
+		return;
 	}
 
-	uint64_t lsb;
-	if (!shared_state_->rand_b_initialized) {
-		shared_state_->rand_b = random_source_
-		                            ? random_source_()
-		                            : std::uniform_int_distribution<uint64_t>{}(
-		                                  shared_state_->random_engine) &
-		                                  UUID_RANDOM_MASK;
-		shared_state_->rand_b_initialized = true;
+	const uint64_t first = reserve(count);
+	const uint64_t rand_b = randB();
+	const uint64_t base = first & ~COUNTER_MAX;
+	uint64_t counter = first & COUNTER_MAX;
+	for (size_t i = 0; i < count; ++i) {
+		setUuid(uuids[i], base | counter, rand_b);
+		if (counter < COUNTER_MAX) {
+			++counter;
+		}
 	}
-	lsb = shared_state_->rand_b;
+}
 
-	// set the Variant to 10b
-	lsb |= static_cast<uint64_t>(UUID_VARIANT_RFC4122) << UUID_VARIANT_SHIFT;
+uint64_t UuidBuilder::reserve(size_t count) {
+	count = std::max<size_t>(count, 1);
+	auto now = time_source_ ? time_source_() : std::chrono::system_clock::now();
+	auto unix_ts_ms = static_cast<uint64_t>(
+	    std::chrono::time_point_cast<std::chrono::milliseconds>(now)
+	        .time_since_epoch()
+	        .count());
+
+	// Claim the next range of (timestamp, counter) pairs. The counter resets
+	// when the timestamp tick advances and freezes at its maximum value. A
+	// timestamp slightly older than the last one used (e.g. read just before
+	// another thread's update, or a small clock adjustment) continues from
+	// the last one so that UUIDs stay monotonic. A large step back starts
+	// over from the new time rather than freezing every UUID until the
+	// clock catches up.
+	auto& ts_counter = shared_state_->ts_counter;
+	uint64_t current = ts_counter.load(std::memory_order_relaxed);
+	uint64_t first;
+	uint64_t last;
+	do {
+		const uint64_t last_ts = current >> COUNTER_BITS;
+		if ((current == NO_TIMESTAMP) || (unix_ts_ms > last_ts) ||
+		    (last_ts - unix_ts_ms > MAX_CLOCK_REGRESSION_MS)) {
+			first = unix_ts_ms << COUNTER_BITS;
+		} else if ((current & COUNTER_MAX) < COUNTER_MAX) {
+			first = current + 1;
+		} else {
+			// Counter has reached maximum value, freeze it
+			return current;
+		}
+		const uint64_t available = COUNTER_MAX - (first & COUNTER_MAX);
+		last = first + std::min<uint64_t>(count - 1, available);
+	} while (!ts_counter.compare_exchange_weak(current, last,
+	                                           std::memory_order_relaxed));
+
+	return first;
+}
 
-	uuid.set_msb(msb);
-	uuid.set_lsb(lsb);
-	return uuid;
+uint64_t UuidBuilder::randB() {
+	std::call_once(shared_state_->rand_b_once, [this]() {
+		if (random_source_) {
+			shared_state_->rand_b = random_source_();
+		} else {
+			std::mt19937_64 random_engine{std::random_device{}()};
+			shared_state_->rand_b =
+			    std::uniform_int_distribution<uint64_t>{}(random_engine) &
+			    UUID_RANDOM_MASK;
+		}
+	});
+	return shared_state_->rand_b;
 }
 
 UuidBuilder::UuidBuilder(bool testing)
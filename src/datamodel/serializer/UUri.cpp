@@ -10,30 +10,87 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "up-cpp/datamodel/serializer/UUri.h"
 
+#include <algorithm>
 #include <charconv>
-#include <sstream>
+#include <stdexcept>
 
 #include "up-cpp/datamodel/validator/UUri.h"
 
 namespace uprotocol::datamodel::serializer::uri {
 
-std::string AsString::serialize(const v1::UUri& uri) {
+namespace {
+
+/// @brief Upper bound on the serialized length of a UUri: authority prefix,
+///        three separators, and three 32-bit numbers in hex.
+size_t maxSerializedLength(const v1::UUri& uri) {
+	constexpr size_t max_hex_digits = 2 * sizeof(uint32_t);
+	return uri.authority_name().size() + 2 + 3 * (1 + max_hex_digits);
+}
+
+void checkValid(const v1::UUri& uri, AsString::Validation validation) {
+	if (validation == AsString::Validation::TRUSTED) {
+		return;
+	}
 	using namespace uprotocol::datamodel::validator::uri;
 	auto [valid, reason] = isValid(uri);
 	if (!valid) {
 		throw std::invalid_argument("Invalid UUri For Serialization | " +
 		                            std::string(message(*reason)));
 	}
-	std::stringstream ss;
-	ss << std::hex << std::uppercase;
+}
 
-	if (!isLocal(uri)) {
-		ss << "//" << uri.authority_name();
+/// @brief Writes "/" followed by the value in uppercase hex.
+char* writeSegment(char* out, uint32_t value) {
+	*out++ = '/';
+	char* digits = out;
+	out = std::to_chars(out, out + 2 * sizeof(value), value, 16).ptr;
+	for (; digits != out; ++digits) {
+		if (*digits >= 'a') {
+			*digits -= 'a' - 'A';
+		}
 	}
-	ss << "/" << uri.ue_id() << "/" << uri.ue_version_major() << "/"
-	   << uri.resource_id();
+	return out;
+}
 
-	return std::move(ss).str();
+/// @brief Writes the serialized UUri to out, which must have room for at
+///        least maxSerializedLength() characters.
+///
+/// @returns Pointer one past the last character written.
+char* write(const v1::UUri& uri, char* out) {
+	if (!uri.authority_name().empty()) {
+		*out++ = '/';
+		*out++ = '/';
+		const auto& authority = uri.authority_name();
+		out = std::copy(authority.begin(), authority.end(), out);
+	}
+	out = writeSegment(out, uri.ue_id());
+	out = writeSegment(out, uri.ue_version_major());
+	return writeSegment(out, uri.resource_id());
+}
+
+}  // namespace
+
+std::string AsString::serialize(const v1::UUri& uri, Validation validation) {
+	std::string out;
+	serialize(uri, out, validation);
+	return out;
+}
+
+void AsString::serialize(const v1::UUri& uri, std::string& out,
+                         Validation validation) {
+	checkValid(uri, validation);
+	out.resize(maxSerializedLength(uri));
+	out.resize(write(uri, out.data()) - out.data());
+}
+
+std::string_view AsString::serialize(const v1::UUri& uri,
+                                     char (&buffer)[BUFFER_SIZE],
+                                     Validation validation) {
+	checkValid(uri, validation);
+	if (maxSerializedLength(uri) > BUFFER_SIZE) {
+		throw std::length_error("UUri too long for serialization buffer");
+	}
+	return {buffer, static_cast<size_t>(write(uri, buffer) - buffer)};
 }
 
 std::string_view extractSegment(std::string_view& uriView) {
@@ -115,4 +172,84 @@ uprotocol::v1::UUri AsString::deserialize(const std::string& uriAsString) {
 	}
 	return uri;
 }
+
+namespace {
+constexpr size_t UE_ID_OFFSET = 0;
+constexpr size_t RESOURCE_ID_OFFSET = 4;
+constexpr size_t VERSION_OFFSET = 6;
+constexpr size_t AUTHORITY_SIZE_OFFSET = 7;
+constexpr uint32_t MAX_RESOURCE_ID = 0xFFFF;
+constexpr uint32_t MAX_VERSION = 0xFF;
+}  // namespace
+
+size_t AsBytes::serializedSize(const v1::UUri& uri) {
+	return HEADER_SIZE + uri.authority_name().size();
+}
+
+std::vector<uint8_t> AsBytes::serialize(const v1::UUri& uri) {
+	std::vector<uint8_t> bytes(serializedSize(uri));
+	serialize(uri, bytes.data(), bytes.size());
+	return bytes;
+}
+
+size_t AsBytes::serialize(const v1::UUri& uri, uint8_t* buffer,
+                          size_t size) {
+	const auto& authority = uri.authority_name();
+	if (authority.size() > MAX_AUTHORITY_SIZE) {
+		throw std::invalid_argument("UUri authority too long to encode");
+	}
+	if (uri.resource_id() > MAX_RESOURCE_ID) {
+		throw std::invalid_argument("UUri resource ID too large to encode");
+	}
+	if (uri.ue_version_major() > MAX_VERSION) {
+		throw std::invalid_argument("UUri major version too large to encode");
+	}
+	const size_t encoded_size = serializedSize(uri);
+	if (size < encoded_size) {
+		throw std::length_error("Buffer too small for encoded UUri");
+	}
+
+	const uint32_t ue_id = uri.ue_id();
+	buffer[UE_ID_OFFSET] = static_cast<uint8_t>(ue_id >> 24);
+	buffer[UE_ID_OFFSET + 1] = static_cast<uint8_t>(ue_id >> 16);
+	buffer[UE_ID_OFFSET + 2] = static_cast<uint8_t>(ue_id >> 8);
+	buffer[UE_ID_OFFSET + 3] = static_cast<uint8_t>(ue_id);
+	buffer[RESOURCE_ID_OFFSET] = static_cast<uint8_t>(uri.resource_id() >> 8);
+	buffer[RESOURCE_ID_OFFSET + 1] = static_cast<uint8_t>(uri.resource_id());
+	buffer[VERSION_OFFSET] = static_cast<uint8_t>(uri.ue_version_major());
+	buffer[AUTHORITY_SIZE_OFFSET] = static_cast<uint8_t>(authority.size());
+	std::copy(authority.begin(), authority.end(), buffer + HEADER_SIZE);
+
+	return encoded_size;
+}
+
+v1::UUri AsBytes::deserialize(const std::vector<uint8_t>& bytes) {
+	auto uri = deserialize(bytes.data(), bytes.size());
+	if (serializedSize(uri) != bytes.size()) {
+		throw std::invalid_argument("Trailing bytes after encoded UUri");
+	}
+	return uri;
+}
+
+v1::UUri AsBytes::deserialize(const uint8_t* buffer, size_t size) {
+	if ((size < HEADER_SIZE) ||
+	    (size < HEADER_SIZE + buffer[AUTHORITY_SIZE_OFFSET])) {
+		throw std::invalid_argument("Buffer too short for encoded UUri");
+	}
+
+	v1::UUri uri;
+	uri.set_ue_id((static_cast<uint32_t>(buffer[UE_ID_OFFSET]) << 24) |
+	              (static_cast<uint32_t>(buffer[UE_ID_OFFSET + 1]) << 16) |
+	              (static_cast<uint32_t>(buffer[UE_ID_OFFSET + 2]) << 8) |
+	              static_cast<uint32_t>(buffer[UE_ID_OFFSET + 3]));
+	uri.set_resource_id(
+	    (static_cast<uint32_t>(buffer[RESOURCE_ID_OFFSET]) << 8) |
+	    static_cast<uint32_t>(buffer[RESOURCE_ID_OFFSET + 1]));
+	uri.set_ue_version_major(buffer[VERSION_OFFSET]);
+	uri.set_authority_name(
+	    reinterpret_cast<const char*>(buffer + HEADER_SIZE),
+	    buffer[AUTHORITY_SIZE_OFFSET]);
+	return uri;
+}
+
 }  // namespace uprotocol::datamodel::serializer::uri
\ No newline at end of file
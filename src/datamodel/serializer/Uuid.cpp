@@ -13,109 +13,134 @@
 
 #include <arpa/inet.h>
 
-#include <iomanip>
-#include <sstream>
+#include <array>
+#include <cstring>
 #include <stdexcept>
 
 namespace {
-constexpr uint64_t TIMESTAMP_MASK = 0xFFFFFFFFFFFF;
-constexpr uint64_t TIMESTAMP_SHIFT = 16;
-constexpr uint64_t VERSION_MASK = 0xF;
-constexpr uint64_t VERSION_SHIFT = 12;
-constexpr uint64_t COUNTER_MASK = 0xFFF;
-constexpr uint64_t VARIANT_MASK = 0x3;
-constexpr uint64_t VARIANT_SHIFT = 62;
-constexpr uint64_t RANDOM_MASK = 0x3FFFFFFFFFFFFFFF;
-constexpr uint64_t RANDOM_SHIFT = 48;
 constexpr size_t UUID_BYTE_SIZE = 16;
 constexpr size_t UUID_PART_SIZE = 4;
-constexpr uint32_t HEX_BASE = 16;
 constexpr uint64_t MASK_32_BITS = 0xFFFFFFFF;
-constexpr uint64_t MASK_16_BITS = 0xFFFF;
-constexpr uint64_t MASK_14_BITS = 0x3FFF;
 constexpr size_t MSB_HIGH_ = 0;
 constexpr size_t MSB_LOW__ = 4;
 constexpr size_t LSB_HIGH_ = 8;
 constexpr size_t LSB_LOW__ = 12;
+
+// Format  : 12345678-1234-1234-1234-123456789012
+// Index   : 01234567890123456789012345678901234
+// Layout  : ***msb**-lsb*-vcnt-varr-***RAND*****
+// msb - timestamp most significant bits (32 bits)
+// lsb - timestamp least significant bits (16 bits)
+// v - version (4 bits)
+// cnt - counter (12 bits)
+// var - variant (2 bits)
+// RAND - random (62 bits)
+// Please check UP-spec for UUID formatting:
+// https://github.com/eclipse-uprotocol/up-spec/blob/main/basics/uuid.adoc
+//
+// Every field is a contiguous run of bits in msb/lsb, so the string is just
+// the 16 bytes of the UUID in hex with dashes between some of them.
+
+/// @brief Offset in the string of the two hex digits for each UUID byte,
+///        most significant byte of msb first.
+constexpr std::array<uint8_t, UUID_BYTE_SIZE> BYTE_OFFSETS = {
+    0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+constexpr std::array<size_t, 4> DASH_OFFSETS = {8, 13, 18, 23};
+
+constexpr uint8_t INVALID_NIBBLE = 0xFF;
+
+/// @brief Two lowercase hex digits for every byte value
+constexpr std::array<char, 512> makeHexPairs() {
+	constexpr char digits[] = "0123456789abcdef";
+	std::array<char, 512> pairs{};
+	for (size_t i = 0; i < 256; ++i) {
+		pairs[2 * i] = digits[i >> 4];
+		pairs[2 * i + 1] = digits[i & 0xF];
+	}
+	return pairs;
+}
+
+/// @brief Nibble value for every character, or INVALID_NIBBLE
+constexpr std::array<uint8_t, 256> makeNibbles() {
+	std::array<uint8_t, 256> nibbles{};
+	for (size_t i = 0; i < nibbles.size(); ++i) {
+		nibbles[i] = INVALID_NIBBLE;
+	}
+	for (uint8_t i = 0; i < 10; ++i) {
+		nibbles['0' + i] = i;
+	}
+	for (uint8_t i = 0; i < 6; ++i) {
+		nibbles['a' + i] = 10 + i;
+		nibbles['A' + i] = 10 + i;
+	}
+	return nibbles;
+}
+
+constexpr auto HEX_PAIRS = makeHexPairs();
+constexpr auto NIBBLES = makeNibbles();
+
+void encode(uint64_t word, const uint8_t* offsets, char* out) {
+	for (size_t i = 0; i < sizeof(word); ++i) {
+		const auto byte = static_cast<uint8_t>(word >> (56 - 8 * i));
+		std::memcpy(out + offsets[i], &HEX_PAIRS[2 * byte], 2);
+	}
+}
+
+/// @brief Decodes 8 bytes of hex into a word. Any invalid digit sets
+///        INVALID_NIBBLE bits in `invalid`.
+uint64_t decode(std::string_view str, const uint8_t* offsets,
+                uint8_t& invalid) {
+	uint64_t word = 0;
+	for (size_t i = 0; i < sizeof(word); ++i) {
+		const uint8_t high = NIBBLES[static_cast<uint8_t>(str[offsets[i]])];
+		const uint8_t low = NIBBLES[static_cast<uint8_t>(str[offsets[i] + 1])];
+		invalid |= high | low;
+		word = (word << 8) | static_cast<uint64_t>((high << 4) | low);
+	}
+	return word;
+}
+
 }  // namespace
 
 namespace uprotocol::datamodel::serializer::uuid {
 
 std::string AsString::serialize(const uprotocol::v1::UUID uuid) {
-	// Extracting the parts of the UUIDv8
-	uint64_t unix_ts_ms = (uuid.msb() >> TIMESTAMP_SHIFT) & TIMESTAMP_MASK;
-	uint8_t ver = (uuid.msb() >> VERSION_SHIFT) & VERSION_MASK;
-	uint16_t counter = uuid.msb() & COUNTER_MASK;
-	uint8_t var = (uuid.lsb() >> VARIANT_SHIFT) & VARIANT_MASK;
-	uint64_t rand_b = uuid.lsb() & RANDOM_MASK;
-
-	// Formatting the UUIDv8 in the traditional format
-	std::stringstream ss;
-	ss << std::hex << std::setfill('0') << std::setw(8)
-	   << ((unix_ts_ms >> 16) & MASK_32_BITS)  // First 32 bits of timestamp
-	   << "-" << std::setw(4)
-	   << ((unix_ts_ms)&MASK_16_BITS)  // Next 16 bits of timestamp i.e. last 16
-	                                   // bit of ts
-	   << "-" << std::setw(4)
-	   << (((ver & VERSION_MASK) << 12) |
-	       (counter & COUNTER_MASK))  // Last 16 bits of timestamp and version
-	   << "-" << std::setw(4)
-	   << (((var & VARIANT_MASK) << 14) |
-	       ((rand_b >> RANDOM_SHIFT) & MASK_14_BITS))  // Variant and randb
-	   << "-" << std::setw(12) << (rand_b & TIMESTAMP_MASK);  // Random number
-
-	return std::move(ss).str();
+	char buffer[STRING_LENGTH];
+	serialize(uuid, buffer);
+	return std::string(buffer, STRING_LENGTH);
 }
 
-uprotocol::v1::UUID AsString::deserialize(const std::string& str) {
-	// Check if the UUID string is in the correct format
-	// Format  : 12345678-1234-1234-1234-123456789012
-	// Index   : 01234567890123456789012345678901234
-	// Layout  : ***msb**-lsb*-vcnt-varr-***RAND*****
-	// msb - timestamp most significant bits (32 bits)
-	// lsb - timestamp least significant bits (16 bits)
-	// v - version (4 bits)
-	// cnt - counter (12 bits)
-	// var - variant (2 bits)
-	// RAND - random (62 bits)
-	// Please check UP-spec for UUID formatting:
-	// https://github.com/eclipse-uprotocol/up-spec/blob/main/basics/uuid.adoc
-
-	if (str.length() != 36 || str[8] != '-' || str[13] != '-' ||
-	    str[18] != '-' || str[23] != '-') {
-		throw std::invalid_argument("Invalid UUID string format");
+void AsString::serialize(const uprotocol::v1::UUID& uuid,
+                         char (&buffer)[STRING_LENGTH]) {
+	encode(uuid.msb(), &BYTE_OFFSETS[0], buffer);
+	encode(uuid.lsb(), &BYTE_OFFSETS[sizeof(uint64_t)], buffer);
+	for (auto offset : DASH_OFFSETS) {
+		buffer[offset] = '-';
 	}
+}
 
-	uprotocol::v1::UUID uuid;
-	uint64_t unix_ts_ms = 0;
-	uint8_t ver = 0;
-	uint16_t counter = 0;
-	uint8_t var = 0;
-	uint64_t rand_b = 0;
-
-	try {
-		// Extract the parts from the UUID string
-		unix_ts_ms = std::stoull(str.substr(0, 8), nullptr, HEX_BASE) << 16;
-		unix_ts_ms |= std::stoull(str.substr(9, 4), nullptr, HEX_BASE);
-
-		uint16_t ver_counter = std::stoul(str.substr(14, 4), nullptr, HEX_BASE);
-		ver = (ver_counter >> 12) & VERSION_MASK;
-		counter = ver_counter & COUNTER_MASK;
-
-		uint16_t var_randb = std::stoul(str.substr(19, 4), nullptr, HEX_BASE);
-		var = (var_randb >> 14) & VARIANT_MASK;
-		rand_b = static_cast<uint64_t>(var_randb & MASK_14_BITS)
-		         << RANDOM_SHIFT;
-		rand_b |= std::stoull(str.substr(24), nullptr, HEX_BASE);
-	} catch (const std::exception& e) {
+uprotocol::v1::UUID AsString::deserialize(std::string_view str) {
+	if (str.length() != STRING_LENGTH) {
 		throw std::invalid_argument("Invalid UUID string format");
 	}
+	for (auto offset : DASH_OFFSETS) {
+		if (str[offset] != '-') {
+			throw std::invalid_argument("Invalid UUID string format");
+		}
+	}
 
-	// Reconstruct the UUID
-	uuid.set_msb((unix_ts_ms << TIMESTAMP_SHIFT) | (ver << VERSION_SHIFT) |
-	             counter);
-	uuid.set_lsb((static_cast<uint64_t>(var) << VARIANT_SHIFT) | rand_b);
+	// Validity is checked once at the end to keep the decode loop branchless
+	uint8_t invalid = 0;
+	const uint64_t msb = decode(str, &BYTE_OFFSETS[0], invalid);
+	const uint64_t lsb = decode(str, &BYTE_OFFSETS[sizeof(uint64_t)], invalid);
+	if (invalid & 0xF0) {
+		throw std::invalid_argument("Invalid UUID string format");
+	}
 
+	uprotocol::v1::UUID uuid;
+	uuid.set_msb(msb);
+	uuid.set_lsb(lsb);
 	return uuid;
 }
 
@@ -55,33 +55,13 @@ std::string_view message(Reason reason) {
 	}
 }
 
-ValidationResult isValid(const v1::UMessage& umessage) {
-	{
-		auto [valid, reason] = isValidRpcRequest(umessage);
-		if (valid) {
-			return {true, {}};
-		}
-	}
+namespace {
 
-	{
-		auto [valid, reason] = isValidRpcResponse(umessage);
-		if (valid) {
-			return {true, {}};
-		}
-	}
+using TimePoint = std::chrono::system_clock::time_point;
 
-	{
-		auto [valid, reason] = isValidPublish(umessage);
-		if (valid) {
-			return {true, {}};
-		}
-	}
-
-	return isValidNotification(umessage);
-}
-
-ValidationResult areCommonAttributesValid(const v1::UMessage& umessage) {
-	auto [valid, reason] = uuid::isUuid(umessage.attributes().id());
+ValidationResult commonAttributes(const v1::UMessage& umessage,
+                                  TimePoint now) {
+	auto [valid, reason] = uuid::isUuid(umessage.attributes().id(), now);
 	if (!valid) {
 		return {false, Reason::BAD_ID};
 	}
@@ -89,7 +69,7 @@ ValidationResult areCommonAttributesValid(const v1::UMessage& umessage) {
 	if (umessage.attributes().has_ttl() && (umessage.attributes().ttl() > 0)) {
 		auto [expired, reason] = uuid::isExpired(
 		    umessage.attributes().id(),
-		    std::chrono::milliseconds(umessage.attributes().ttl()));
+		    std::chrono::milliseconds(umessage.attributes().ttl()), now);
 		if (expired) {
 			return {false, Reason::ID_EXPIRED};
 		}
@@ -106,17 +86,10 @@ ValidationResult areCommonAttributesValid(const v1::UMessage& umessage) {
 	return {true, {}};
 }
 
-ValidationResult isValidRpcRequest(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_REQUEST) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
+// The *Attributes() functions below check the rules specific to one message
+// type. They assume commonAttributes() and the type check already passed.
 
+ValidationResult rpcRequestAttributes(const v1::UMessage& umessage) {
 	if (!umessage.attributes().has_source()) {
 		return {false, Reason::BAD_SOURCE_URI};
 	}
@@ -161,17 +134,8 @@ ValidationResult isValidRpcRequest(const v1::UMessage& umessage) {
 	return {true, {}};
 }
 
-ValidationResult isValidRpcResponse(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_RESPONSE) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
-
+ValidationResult rpcResponseAttributes(const v1::UMessage& umessage,
+                                       TimePoint now) {
 	if (!umessage.attributes().has_source()) {
 		return {false, Reason::BAD_SOURCE_URI};
 	}
@@ -201,7 +165,8 @@ ValidationResult isValidRpcResponse(const v1::UMessage& umessage) {
 	}
 
 	{
-		auto [valid, reason] = uuid::isUuid(umessage.attributes().reqid());
+		auto [valid, reason] =
+		    uuid::isUuid(umessage.attributes().reqid(), now);
 		if (!valid) {
 			return {false, Reason::REQID_MISMATCH};
 		}
@@ -210,7 +175,7 @@ ValidationResult isValidRpcResponse(const v1::UMessage& umessage) {
 	if (umessage.attributes().has_ttl() && (umessage.attributes().ttl() > 0)) {
 		auto [expired, reason] = uuid::isExpired(
 		    umessage.attributes().reqid(),
-		    std::chrono::milliseconds(umessage.attributes().ttl()));
+		    std::chrono::milliseconds(umessage.attributes().ttl()), now);
 		if (expired) {
 			return {false, Reason::ID_EXPIRED};
 		}
@@ -231,46 +196,7 @@ ValidationResult isValidRpcResponse(const v1::UMessage& umessage) {
 	return {true, {}};
 }
 
-ValidationResult isValidRpcResponseFor(const v1::UMessage& request,
-                                       const v1::UMessage& response) {
-	auto [valid, reason] = isValidRpcResponse(response);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (!google::protobuf::util::MessageDifferencer::Equals(
-	        response.attributes().source(), request.attributes().sink())) {
-		return {false, Reason::URI_MISMATCH};
-	}
-
-	if (!google::protobuf::util::MessageDifferencer::Equals(
-	        response.attributes().sink(), request.attributes().source())) {
-		return {false, Reason::URI_MISMATCH};
-	}
-
-	if (!google::protobuf::util::MessageDifferencer::Equals(
-	        response.attributes().reqid(), request.attributes().id())) {
-		return {false, Reason::REQID_MISMATCH};
-	}
-
-	if (request.attributes().priority() != response.attributes().priority()) {
-		return {false, Reason::PRIORITY_MISMATCH};
-	}
-
-	return {true, {}};
-}
-
-ValidationResult isValidPublish(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_PUBLISH) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
-
+ValidationResult publishAttributes(const v1::UMessage& umessage) {
 	if (!umessage.attributes().has_source()) {
 		return {false, Reason::BAD_SOURCE_URI};
 	}
@@ -306,17 +232,7 @@ ValidationResult isValidPublish(const v1::UMessage& umessage) {
 	return {true, {}};
 }
 
-ValidationResult isValidNotification(const v1::UMessage& umessage) {
-	auto [valid, reason] = areCommonAttributesValid(umessage);
-	if (!valid) {
-		return {false, reason};
-	}
-
-	if (umessage.attributes().type() !=
-	    v1::UMessageType::UMESSAGE_TYPE_NOTIFICATION) {
-		return {false, Reason::WRONG_MESSAGE_TYPE};
-	}
-
+ValidationResult notificationAttributes(const v1::UMessage& umessage) {
 	if (!umessage.attributes().has_source()) {
 		return {false, Reason::BAD_SOURCE_URI};
 	}
@@ -360,4 +276,88 @@ ValidationResult isValidNotification(const v1::UMessage& umessage) {
 	return {true, {}};
 }
 
+/// @brief Validates a message against the rules for one message type,
+///        reading the clock only once.
+ValidationResult validateAs(const v1::UMessage& umessage,
+                            v1::UMessageType type) {
+	const auto now = std::chrono::system_clock::now();
+
+	auto [valid, reason] = commonAttributes(umessage, now);
+	if (!valid) {
+		return {false, reason};
+	}
+
+	if (umessage.attributes().type() != type) {
+		return {false, Reason::WRONG_MESSAGE_TYPE};
+	}
+
+	switch (type) {
+		case v1::UMessageType::UMESSAGE_TYPE_REQUEST:
+			return rpcRequestAttributes(umessage);
+		case v1::UMessageType::UMESSAGE_TYPE_RESPONSE:
+			return rpcResponseAttributes(umessage, now);
+		case v1::UMessageType::UMESSAGE_TYPE_PUBLISH:
+			return publishAttributes(umessage);
+		case v1::UMessageType::UMESSAGE_TYPE_NOTIFICATION:
+			return notificationAttributes(umessage);
+		default:
+			return {false, Reason::WRONG_MESSAGE_TYPE};
+	}
+}
+
+}  // namespace
+
+ValidationResult isValid(const v1::UMessage& umessage) {
+	return validateAs(umessage, umessage.attributes().type());
+}
+
+ValidationResult areCommonAttributesValid(const v1::UMessage& umessage) {
+	return commonAttributes(umessage, std::chrono::system_clock::now());
+}
+
+ValidationResult isValidRpcRequest(const v1::UMessage& umessage) {
+	return validateAs(umessage, v1::UMessageType::UMESSAGE_TYPE_REQUEST);
+}
+
+ValidationResult isValidRpcResponse(const v1::UMessage& umessage) {
+	return validateAs(umessage, v1::UMessageType::UMESSAGE_TYPE_RESPONSE);
+}
+
+ValidationResult isValidRpcResponseFor(const v1::UMessage& request,
+                                       const v1::UMessage& response) {
+	auto [valid, reason] = isValidRpcResponse(response);
+	if (!valid) {
+		return {false, reason};
+	}
+
+	if (!google::protobuf::util::MessageDifferencer::Equals(
+	        response.attributes().source(), request.attributes().sink())) {
+		return {false, Reason::URI_MISMATCH};
+	}
+
+	if (!google::protobuf::util::MessageDifferencer::Equals(
+	        response.attributes().sink(), request.attributes().source())) {
+		return {false, Reason::URI_MISMATCH};
+	}
+
+	if (!google::protobuf::util::MessageDifferencer::Equals(
+	        response.attributes().reqid(), request.attributes().id())) {
+		return {false, Reason::REQID_MISMATCH};
+	}
+
+	if (request.attributes().priority() != response.attributes().priority()) {
+		return {false, Reason::PRIORITY_MISMATCH};
+	}
+
+	return {true, {}};
+}
+
+ValidationResult isValidPublish(const v1::UMessage& umessage) {
+	return validateAs(umessage, v1::UMessageType::UMESSAGE_TYPE_PUBLISH);
+}
+
+ValidationResult isValidNotification(const v1::UMessage& umessage) {
+	return validateAs(umessage, v1::UMessageType::UMESSAGE_TYPE_NOTIFICATION);
+}
+
 }  // namespace uprotocol::datamodel::validator::message
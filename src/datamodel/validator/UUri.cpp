@@ -11,10 +11,25 @@
 
 #include "up-cpp/datamodel/validator/UUri.h"
 
+#include <algorithm>
+
+#include "up-cpp/utils/UUriKey.h"
+
 namespace uprotocol::datamodel::validator::uri {
 
 using namespace uprotocol;
 
+namespace {
+/// @brief Checks for an authority that contains '*' without being the "*"
+///        wildcard. Listener matching (see utils::UUriMatcher) only treats a
+///        bare "*" as a wildcard, so such a filter could never match.
+bool hasPartialWildcardAuthority(const v1::UUri& uuri) {
+	const auto& authority = uuri.authority_name();
+	return (authority != "*") &&
+	       (authority.find('*') != std::string::npos);
+}
+}  // namespace
+
 std::string_view message(Reason reason) {
 	switch (reason) {
 		case Reason::EMPTY:
@@ -53,28 +68,14 @@ bool uses_wildcards(const v1::UUri& uuri) {
 	return false;
 }
 
-ValidationResult isValid(const v1::UUri& uuri) {
-	{
-		auto [valid, reason] = isValidRpcMethod(uuri);
-		if (valid) {
-			return {true, std::nullopt};
-		}
-	}
+bool uses_wildcards(const utils::UUriKey& key) { return key.usesWildcards(); }
 
-	{
-		auto [valid, reason] = isValidRpcResponse(uuri);
-		if (valid) {
-			return {true, std::nullopt};
-		}
-	}
-
-	{
-		auto [valid, reason] = isValidPublishTopic(uuri);
-		if (valid) {
-			return {true, std::nullopt};
-		}
+ValidationResult isValid(const v1::UUri& uuri) {
+	if (classify(uuri) & ANY_MESSAGE_FORM) {
+		return {true, std::nullopt};
 	}
 
+	// Only reached for invalid URIs, where the reason is needed
 	return isValidNotification(uuri);
 }
 
@@ -150,6 +151,30 @@ ValidationResult isValidSubscription(const v1::UUri& uuri) {
 	return {true, std::nullopt};
 }
 
+ValidationResult isValidFilter(const v1::UUri& uuri) {
+	if (classify(uuri) & FILTER) {
+		return {true, std::nullopt};
+	}
+
+	// Only reached for invalid filters, where the reason is needed
+	{
+		auto [empty, reason] = isEmpty(uuri);
+		if (empty) {
+			return {false, Reason::EMPTY};
+		}
+	}
+
+	if (!uses_wildcards(uuri)) {
+		return isValid(uuri);
+	}
+
+	if (hasPartialWildcardAuthority(uuri)) {
+		return {false, Reason::DISALLOWED_WILDCARD};
+	}
+
+	return {false, Reason::BAD_RESOURCE_ID};
+}
+
 ValidationResult isEmpty(const v1::UUri& uuri) {
 	if (!std::all_of(uuri.authority_name().begin(), uuri.authority_name().end(),
 	                 isspace)) {
@@ -173,4 +198,48 @@ ValidationResult isEmpty(const v1::UUri& uuri) {
 
 bool isLocal(const v1::UUri& uuri) { return (uuri.authority_name().empty()); }
 
+FormMask classify(const v1::UUri& uuri) {
+	const uint32_t resource_id = uuri.resource_id();
+	const bool in_topic_range = (resource_id >= 0x8000) &&
+	                            (resource_id <= 0xFFFF);
+
+	FormMask forms = in_topic_range ? SUBSCRIPTION : 0;
+
+	if (uses_wildcards(uuri)) {
+		if (hasPartialWildcardAuthority(uuri)) {
+			return forms;
+		}
+		// Wildcard filters only need an in-range resource ID. An empty URI
+		// counts as using wildcards (its instance ID is 0), but is never a
+		// valid filter.
+		if (resource_id <= 0xFFFF) {
+			const bool maybe_empty = (uuri.ue_id() == 0) &&
+			                         (uuri.ue_version_major() == 0) &&
+			                         (resource_id == 0);
+			if (!maybe_empty || !std::get<0>(isEmpty(uuri))) {
+				forms |= FILTER;
+			}
+		}
+		return forms;
+	}
+
+	if (resource_id == 0) {
+		forms |= RPC_RESPONSE | NOTIFICATION;
+		if (!uuri.authority_name().empty()) {
+			forms |= DEFAULT_SOURCE;
+		}
+	} else if (resource_id < 0x8000) {
+		forms |= RPC_METHOD;
+	} else if (in_topic_range) {
+		forms |= PUBLISH_TOPIC | NOTIFICATION;
+	}
+
+	// Filters without wildcards must pass isValid()
+	if (forms & ANY_MESSAGE_FORM) {
+		forms |= FILTER;
+	}
+
+	return forms;
+}
+
 }  // namespace uprotocol::datamodel::validator::uri
@@ -61,9 +61,16 @@ std::string_view message(Reason reason) {
 }
 
 ValidationResult isUuid(const uprotocol::v1::UUID uuid) {
-	uint64_t msb = uuid.msb();
-	uint64_t lsb = uuid.lsb();
+	return isUuid(uuid, std::chrono::system_clock::now());
+}
+
+ValidationResult isExpired(const uprotocol::v1::UUID uuid,
+                           std::chrono::milliseconds ttl) {
+	return isExpired(uuid, ttl, std::chrono::system_clock::now());
+}
 
+ValidationResult isUuid(const uprotocol::v1::UUID& uuid,
+                        std::chrono::system_clock::time_point now) {
 	uint8_t version = internalGetVersion(uuid);
 	if (version != 8) {
 		return {false, Reason::WRONG_VERSION};
@@ -75,26 +82,25 @@ ValidationResult isUuid(const uprotocol::v1::UUID uuid) {
 	}
 
 	auto timestamp = getUuidTimestamp(uuid);
-	auto current_time = std::chrono::system_clock::now();
 
-	if (timestamp > current_time) {
+	if (timestamp > now) {
 		return {false, Reason::FROM_THE_FUTURE};
 	}
 
 	return {true, std::nullopt};
 }
 
-ValidationResult isExpired(const uprotocol::v1::UUID uuid,
-                           std::chrono::milliseconds ttl) {
-	auto [valid, reason] = isUuid(uuid);
+ValidationResult isExpired(const uprotocol::v1::UUID& uuid,
+                           std::chrono::milliseconds ttl,
+                           std::chrono::system_clock::time_point now) {
+	auto [valid, reason] = isUuid(uuid, now);
 	if (!valid) {
 		return {false, reason};
 	}
 
 	auto timestamp = getUuidTimestamp(uuid);
-	auto current_time = std::chrono::system_clock::now();
 
-	if ((current_time - timestamp) > ttl) {
+	if ((now - timestamp) > ttl) {
 		return {true, Reason::EXPIRED};
 	}
 
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/transport/AsyncSender.h"
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "up-cpp/datamodel/validator/UMessage.h"
+
+namespace uprotocol::transport {
+
+namespace MessageValidator = uprotocol::datamodel::validator::message;
+
+namespace {
+v1::UStatus makeStatus(v1::UCode code, const std::string& message) {
+	v1::UStatus status;
+	status.set_code(code);
+	status.set_message(message);
+	return status;
+}
+
+/// @brief Calls a completion callback. Exceptions are discarded since the
+///        caller of sendAsync() is not there to receive them, and letting
+///        them escape the sender thread or the destructor would terminate.
+void complete(AsyncSender::Callback& callback, v1::UStatus&& status) {
+	try {
+		callback(std::move(status));
+	} catch (...) {
+	}
+}
+}  // namespace
+
+AsyncSender::AsyncSender(std::shared_ptr<UTransport> transport,
+                         size_t max_queue_size, Backpressure backpressure,
+                         Scheduler::Policy scheduling,
+                         const Scheduler::Weights& weights)
+    : transport_(std::move(transport)),
+      maxQueueSize_(std::max<size_t>(max_queue_size, 1)),
+      backpressure_(backpressure),
+      queue_(scheduling, weights) {
+	if (!transport_) {
+		throw std::invalid_argument("Transport cannot be null");
+	}
+
+	thread_ = std::thread([this]() { run(); });
+}
+
+AsyncSender::~AsyncSender() {
+	{
+		std::lock_guard lock(mutex_);
+		stop_ = true;
+	}
+	notEmpty_.notify_all();
+	notFull_.notify_all();
+	thread_.join();
+
+	std::vector<Entry> cancelled;
+	{
+		std::lock_guard lock(mutex_);
+		queue_.drain(
+		    [&cancelled](Entry&& entry) { cancelled.push_back(std::move(entry)); });
+	}
+	for (auto& entry : cancelled) {
+		complete(entry.callback, makeStatus(v1::UCode::CANCELLED,
+		                                    "AsyncSender was destroyed"));
+	}
+}
+
+void AsyncSender::sendAsync(v1::UMessage&& message, Callback&& callback) {
+	if (!callback) {
+		throw std::invalid_argument("Callback cannot be null");
+	}
+
+	const auto priority = message.attributes().priority();
+	std::optional<Entry> dropped;
+	std::optional<v1::UStatus> rejected;
+
+	{
+		std::unique_lock lock(mutex_);
+		if (backpressure_ == Backpressure::BLOCK) {
+			notFull_.wait(lock, [this]() {
+				return stop_ || (queue_.size() < maxQueueSize_);
+			});
+		}
+
+		if (stop_) {
+			rejected =
+			    makeStatus(v1::UCode::CANCELLED, "AsyncSender was destroyed");
+		} else if (queue_.size() >= maxQueueSize_) {
+			Entry oldest;
+			if ((backpressure_ == Backpressure::DROP_OLDEST) &&
+			    queue_.dropOldest(priority, oldest)) {
+				dropped = std::move(oldest);
+			} else {
+				rejected = makeStatus(v1::UCode::RESOURCE_EXHAUSTED,
+				                      "Outbound queue is full");
+			}
+		}
+
+		if (!rejected) {
+			queue_.push(priority,
+			            Entry{std::move(message), std::move(callback)});
+		}
+	}
+
+	if (rejected) {
+		if (rejected->code() == v1::UCode::RESOURCE_EXHAUSTED) {
+			dropped_.fetch_add(1, std::memory_order_relaxed);
+		}
+		complete(callback, std::move(*rejected));
+		return;
+	}
+
+	notEmpty_.notify_one();
+
+	if (dropped) {
+		dropped_.fetch_add(1, std::memory_order_relaxed);
+		complete(dropped->callback,
+		         makeStatus(v1::UCode::RESOURCE_EXHAUSTED,
+		                    "Dropped from full outbound queue"));
+	}
+}
+
+std::future<v1::UStatus> AsyncSender::sendAsync(v1::UMessage&& message) {
+	auto promise = std::make_shared<std::promise<v1::UStatus>>();
+	auto future = promise->get_future();
+
+	sendAsync(std::move(message), [promise](v1::UStatus status) {
+		promise->set_value(std::move(status));
+	});
+
+	return future;
+}
+
+size_t AsyncSender::queueSize() const {
+	std::lock_guard lock(mutex_);
+	return queue_.size();
+}
+
+uint64_t AsyncSender::droppedCount() const {
+	return dropped_.load(std::memory_order_relaxed);
+}
+
+AsyncSender::Scheduler::ClassStats AsyncSender::queueStats(
+    v1::UPriority priority) const {
+	std::lock_guard lock(mutex_);
+	return queue_.stats(priority);
+}
+
+void AsyncSender::run() {
+	while (true) {
+		Entry entry;
+		{
+			std::unique_lock lock(mutex_);
+			notEmpty_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+			if (stop_) {
+				return;
+			}
+			queue_.pop(entry);
+		}
+		notFull_.notify_one();
+
+		v1::UStatus status;
+		try {
+			status = transport_->send(entry.message);
+		} catch (const MessageValidator::InvalidUMessage& e) {
+			status = makeStatus(v1::UCode::INVALID_ARGUMENT, e.what());
+		} catch (const std::exception& e) {
+			status = makeStatus(v1::UCode::INTERNAL, e.what());
+		} catch (...) {
+			status = makeStatus(v1::UCode::INTERNAL,
+			                    "Unknown exception from UTransport::send()");
+		}
+		complete(entry.callback, std::move(status));
+	}
+}
+
+}  // namespace uprotocol::transport
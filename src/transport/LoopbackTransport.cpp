@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/transport/LoopbackTransport.h"
+
+#include <mutex>
+#include <vector>
+
+namespace uprotocol::transport {
+
+namespace {
+constexpr uint32_t SERVICE_ID_MASK = 0x0000FFFF;
+constexpr uint32_t INSTANCE_ID_MASK = 0xFFFF0000;
+
+/// @brief Gets the URI that a message should be delivered to. Published
+///        messages have no sink, so they are delivered based on the topic.
+const v1::UUri& deliveryAddress(const v1::UMessage& message) {
+	if (message.attributes().has_sink()) {
+		return message.attributes().sink();
+	}
+	return message.attributes().source();
+}
+}  // namespace
+
+LoopbackTransport::LoopbackTransport(const v1::UUri& defaultSrc)
+    : UTransport(defaultSrc) {}
+
+size_t LoopbackTransport::listenerCount() const {
+	std::shared_lock lock(listeners_mtx_);
+	return listener_ids_.size();
+}
+
+v1::UStatus LoopbackTransport::sendImpl(const v1::UMessage& message) {
+	dispatch(message);
+
+	v1::UStatus status;
+	status.set_code(v1::UCode::OK);
+	return status;
+}
+
+v1::UStatus LoopbackTransport::registerListenerImpl(
+    const v1::UUri& sink_filter, CallableConn&& listener,
+    std::optional<v1::UUri>&& source_filter) {
+	{
+		std::unique_lock lock(listeners_mtx_);
+		auto id = sink_index_.insert(
+		    sink_filter, Registration{listener, std::move(source_filter)});
+		listener_ids_.emplace(std::move(listener), id);
+	}
+
+	v1::UStatus status;
+	status.set_code(v1::UCode::OK);
+	return status;
+}
+
+void LoopbackTransport::cleanupListener(CallableConn listener) {
+	std::unique_lock lock(listeners_mtx_);
+
+	auto id_entry = listener_ids_.find(listener);
+	if (id_entry == listener_ids_.end()) {
+		return;
+	}
+
+	sink_index_.erase(id_entry->second);
+	listener_ids_.erase(id_entry);
+}
+
+size_t LoopbackTransport::dispatch(const v1::UMessage& message) {
+	std::vector<CallableConn> matched;
+
+	{
+		std::shared_lock lock(listeners_mtx_);
+		const auto& source = message.attributes().source();
+		sink_index_.forEachMatch(
+		    deliveryAddress(message),
+		    [&source, &matched](const Registration& registration) {
+			    if (registration.source_filter &&
+			        !matches(*registration.source_filter, source)) {
+				    return;
+			    }
+			    matched.push_back(registration.listener);
+		    });
+	}
+
+	// Listeners are called without holding the lock so that they can freely
+	// interact with this transport (e.g. send a response).
+	for (auto& listener : matched) {
+		listener(message);
+	}
+
+	return matched.size();
+}
+
+bool LoopbackTransport::matches(const v1::UUri& filter, const v1::UUri& uri) {
+	if ((filter.authority_name() != SinkIndex::WILDCARD_AUTHORITY) &&
+	    (filter.authority_name() != uri.authority_name())) {
+		return false;
+	}
+
+	const uint32_t filter_service = filter.ue_id() & SERVICE_ID_MASK;
+	if ((filter_service != SinkIndex::WILDCARD_SERVICE_ID) &&
+	    (filter_service != (uri.ue_id() & SERVICE_ID_MASK))) {
+		return false;
+	}
+
+	const uint32_t filter_instance = filter.ue_id() & INSTANCE_ID_MASK;
+	if ((filter_instance != SinkIndex::WILDCARD_INSTANCE_ID) &&
+	    (filter_instance != (uri.ue_id() & INSTANCE_ID_MASK))) {
+		return false;
+	}
+
+	if ((filter.ue_version_major() != SinkIndex::WILDCARD_VERSION) &&
+	    (filter.ue_version_major() != uri.ue_version_major())) {
+		return false;
+	}
+
+	if ((filter.resource_id() != SinkIndex::WILDCARD_RESOURCE) &&
+	    (filter.resource_id() != uri.resource_id())) {
+		return false;
+	}
+
+	return true;
+}
+
+}  // namespace uprotocol::transport
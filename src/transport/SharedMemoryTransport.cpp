@@ -0,0 +1,507 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/transport/SharedMemoryTransport.h"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace uprotocol::transport {
+
+namespace {
+constexpr uint32_t RING_MAGIC = 0x75505348;  // "uPSH"
+constexpr uint32_t RING_LAYOUT_VERSION = 1;
+constexpr size_t CACHE_LINE_SIZE = 64;
+constexpr auto ATTACH_TIMEOUT = std::chrono::seconds(1);
+constexpr auto ATTACH_POLL_INTERVAL = std::chrono::milliseconds(1);
+// Upper bound on how long the receiver sleeps before checking if it has been
+// asked to stop.
+constexpr long RECEIVE_WAIT_NS = 100 * 1000 * 1000;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+                  std::atomic<uint64_t>::is_always_lock_free,
+              "Shared memory ring requires address-free atomics");
+
+/// @brief Lives at the start of the shared memory segment.
+struct RingHeader {
+	/// @brief Set to RING_MAGIC once the creator has initialized the header.
+	std::atomic<uint32_t> magic;
+	uint32_t layout_version;
+	uint32_t slot_count;
+	uint32_t slot_size;
+	/// @brief Next sequence number to be claimed by a writer.
+	alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> write_seq;
+	/// @brief Futex word. Incremented every time a slot is committed.
+	alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> wake_seq;
+	/// @brief Number of receivers currently sleeping on wake_seq.
+	std::atomic<uint32_t> sleepers;
+};
+
+/// @brief Precedes the data in each ring slot.
+///
+/// The state works like a seqlock: it holds ((seq + 1) << 1), with the low
+/// bit set while a writer is filling the slot. Zero means never written.
+struct alignas(CACHE_LINE_SIZE) SlotHeader {
+	std::atomic<uint64_t> state;
+	std::atomic<uint32_t> length;
+};
+
+constexpr uint64_t WRITING_BIT = 1;
+
+constexpr uint64_t committedState(uint64_t seq) { return (seq + 1) << 1; }
+
+constexpr size_t roundUp(size_t value, size_t multiple) {
+	return ((value + multiple - 1) / multiple) * multiple;
+}
+
+using Layout = SharedMemoryTransport::Layout;
+static_assert(offsetof(RingHeader, write_seq) == Layout::WRITE_SEQ_OFFSET);
+static_assert(roundUp(sizeof(RingHeader), CACHE_LINE_SIZE) ==
+              Layout::HEADER_SIZE);
+static_assert(offsetof(SlotHeader, state) == 0);
+static_assert((committedState(7) | WRITING_BIT) == Layout::writingState(7));
+
+size_t headerSize() { return Layout::HEADER_SIZE; }
+
+size_t slotStride(uint32_t slot_size) {
+	return sizeof(SlotHeader) + roundUp(slot_size, CACHE_LINE_SIZE);
+}
+
+size_t segmentSize(uint32_t slot_count, uint32_t slot_size) {
+	return headerSize() + static_cast<size_t>(slot_count) * slotStride(slot_size);
+}
+
+[[noreturn]] void throwErrno(const std::string& what) {
+	throw std::system_error(errno, std::generic_category(), what);
+}
+
+long futexWait(std::atomic<uint32_t>& word, uint32_t expected,
+               const timespec* timeout) {
+	return syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT,
+	               expected, timeout, nullptr, 0);
+}
+
+void futexWakeAll(std::atomic<uint32_t>& word) {
+	syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX,
+	        nullptr, nullptr, 0);
+}
+
+v1::UStatus makeStatus(v1::UCode code, const std::string& message = {}) {
+	v1::UStatus status;
+	status.set_code(code);
+	if (!message.empty()) {
+		status.set_message(message);
+	}
+	return status;
+}
+}  // namespace
+
+struct SharedMemoryTransport::Ring {
+	explicit Ring(const Config& config);
+	~Ring();
+
+	/// @brief Serializes a message into the next slot in the ring.
+	v1::UStatus write(const v1::UMessage& message);
+
+	/// @brief Serializes messages into consecutive slots in the ring,
+	///        waking receivers once at the end.
+	std::vector<v1::UStatus> writeBatch(const v1::UMessage* messages,
+	                                    size_t count);
+
+	/// @brief Writes a message into the slot for a claimed sequence number.
+	void fill(uint64_t seq, const v1::UMessage& message, size_t length);
+
+	/// @brief Signals receivers that new slots have been committed.
+	void wakeReceivers();
+
+	/// @brief Starts the receiver thread, which hands every message read from
+	///        the ring to the deliver callback.
+	void startReceiver(std::function<void(const v1::UMessage&)>&& deliver);
+
+	/// @brief Stops and joins the receiver thread.
+	void stopReceiver();
+
+	SlotHeader& slotAt(uint64_t seq) const;
+	uint8_t* slotData(SlotHeader& slot) const;
+
+	void receiveLoop();
+
+	/// @brief Outcome of attempting to read a single sequence number
+	enum class ReadResult { DELIVERED, SKIPPED, NOT_READY };
+	ReadResult readNext();
+
+	int fd_{-1};
+	void* mapping_{MAP_FAILED};
+	size_t mapping_size_{0};
+	RingHeader* header_{nullptr};
+	uint8_t* slots_{nullptr};
+	uint64_t slot_mask_{0};
+	size_t slot_stride_{0};
+	uint32_t slot_size_{0};
+	std::chrono::milliseconds stale_write_timeout_{0};
+
+	uint64_t next_read_seq_{0};
+	std::atomic<uint64_t> dropped_{0};
+	std::atomic<bool> running_{false};
+	std::thread receiver_;
+	std::function<void(const v1::UMessage&)> deliver_;
+	/// @brief Reused for every received message to avoid reallocating
+	v1::UMessage received_;
+};
+
+SharedMemoryTransport::Ring::Ring(const Config& config) {
+	if (config.name.empty() || (config.name.front() != '/')) {
+		throw std::invalid_argument(
+		    "Shared memory segment name must start with '/'");
+	}
+	if ((config.slot_count == 0) ||
+	    ((config.slot_count & (config.slot_count - 1)) != 0)) {
+		throw std::invalid_argument(
+		    "Shared memory slot count must be a power of two");
+	}
+	if (config.slot_size == 0) {
+		throw std::invalid_argument("Shared memory slot size must be > 0");
+	}
+
+	bool creator = true;
+	fd_ = shm_open(config.name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0660);
+	if ((fd_ < 0) && (errno == EEXIST)) {
+		creator = false;
+		fd_ = shm_open(config.name.c_str(), O_RDWR, 0);
+	}
+	if (fd_ < 0) {
+		throwErrno("Failed to open shared memory segment " + config.name);
+	}
+
+	try {
+		if (creator) {
+			mapping_size_ = segmentSize(config.slot_count, config.slot_size);
+			if (ftruncate(fd_, static_cast<off_t>(mapping_size_)) != 0) {
+				throwErrno("Failed to size shared memory segment");
+			}
+		} else {
+			// The creator may not have sized the segment yet
+			const auto deadline =
+			    std::chrono::steady_clock::now() + ATTACH_TIMEOUT;
+			struct stat info {};
+			while (true) {
+				if (fstat(fd_, &info) != 0) {
+					throwErrno("Failed to inspect shared memory segment");
+				}
+				if (static_cast<size_t>(info.st_size) >= headerSize()) {
+					break;
+				}
+				if (std::chrono::steady_clock::now() > deadline) {
+					throw std::system_error(
+					    std::make_error_code(std::errc::timed_out),
+					    "Shared memory segment was never initialized");
+				}
+				std::this_thread::sleep_for(ATTACH_POLL_INTERVAL);
+			}
+			mapping_size_ = static_cast<size_t>(info.st_size);
+		}
+
+		mapping_ = mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE,
+		                MAP_SHARED, fd_, 0);
+		if (mapping_ == MAP_FAILED) {
+			throwErrno("Failed to map shared memory segment");
+		}
+		header_ = static_cast<RingHeader*>(mapping_);
+
+		if (creator) {
+			// The segment is zero filled by ftruncate(), which is a valid
+			// initial state for all of the atomics.
+			header_->layout_version = RING_LAYOUT_VERSION;
+			header_->slot_count = config.slot_count;
+			header_->slot_size = config.slot_size;
+			header_->magic.store(RING_MAGIC, std::memory_order_release);
+		} else {
+			const auto deadline =
+			    std::chrono::steady_clock::now() + ATTACH_TIMEOUT;
+			while (header_->magic.load(std::memory_order_acquire) !=
+			       RING_MAGIC) {
+				if (std::chrono::steady_clock::now() > deadline) {
+					throw std::system_error(
+					    std::make_error_code(std::errc::timed_out),
+					    "Shared memory segment was never initialized");
+				}
+				std::this_thread::sleep_for(ATTACH_POLL_INTERVAL);
+			}
+			if ((header_->layout_version != RING_LAYOUT_VERSION) ||
+			    (segmentSize(header_->slot_count, header_->slot_size) >
+			     mapping_size_)) {
+				throw std::invalid_argument(
+				    "Shared memory segment has an incompatible layout");
+			}
+		}
+	} catch (...) {
+		if (mapping_ != MAP_FAILED) {
+			munmap(mapping_, mapping_size_);
+		}
+		close(fd_);
+		throw;
+	}
+
+	slot_size_ = header_->slot_size;
+	stale_write_timeout_ = config.stale_write_timeout;
+	slot_mask_ = header_->slot_count - 1;
+	slot_stride_ = slotStride(slot_size_);
+	slots_ = static_cast<uint8_t*>(mapping_) + headerSize();
+	next_read_seq_ = header_->write_seq.load(std::memory_order_acquire);
+}
+
+SharedMemoryTransport::Ring::~Ring() {
+	stopReceiver();
+	munmap(mapping_, mapping_size_);
+	close(fd_);
+}
+
+SlotHeader& SharedMemoryTransport::Ring::slotAt(uint64_t seq) const {
+	return *reinterpret_cast<SlotHeader*>(slots_ +
+	                                      (seq & slot_mask_) * slot_stride_);
+}
+
+uint8_t* SharedMemoryTransport::Ring::slotData(SlotHeader& slot) const {
+	return reinterpret_cast<uint8_t*>(&slot) + sizeof(SlotHeader);
+}
+
+v1::UStatus SharedMemoryTransport::Ring::write(const v1::UMessage& message) {
+	const size_t length = message.ByteSizeLong();
+	if (length > slot_size_) {
+		return makeStatus(v1::UCode::RESOURCE_EXHAUSTED,
+		                  "Message exceeds shared memory slot size");
+	}
+
+	const uint64_t seq =
+	    header_->write_seq.fetch_add(1, std::memory_order_acq_rel);
+	fill(seq, message, length);
+	wakeReceivers();
+
+	return makeStatus(v1::UCode::OK);
+}
+
+std::vector<v1::UStatus> SharedMemoryTransport::Ring::writeBatch(
+    const v1::UMessage* messages, size_t count) {
+	std::vector<v1::UStatus> statuses;
+	statuses.reserve(count);
+	std::vector<size_t> lengths(count);
+	uint64_t to_write = 0;
+	for (size_t i = 0; i < count; ++i) {
+		lengths[i] = messages[i].ByteSizeLong();
+		if (lengths[i] > slot_size_) {
+			statuses.push_back(
+			    makeStatus(v1::UCode::RESOURCE_EXHAUSTED,
+			               "Message exceeds shared memory slot size"));
+		} else {
+			statuses.push_back(makeStatus(v1::UCode::OK));
+			++to_write;
+		}
+	}
+	if (to_write == 0) {
+		return statuses;
+	}
+
+	// One claim and one wakeup for the whole batch
+	uint64_t seq =
+	    header_->write_seq.fetch_add(to_write, std::memory_order_acq_rel);
+	for (size_t i = 0; i < count; ++i) {
+		if (statuses[i].code() == v1::UCode::OK) {
+			fill(seq++, messages[i], lengths[i]);
+		}
+	}
+	wakeReceivers();
+
+	return statuses;
+}
+
+void SharedMemoryTransport::Ring::fill(uint64_t seq,
+                                       const v1::UMessage& message,
+                                       size_t length) {
+	auto& slot = slotAt(seq);
+
+	// Claim the slot. Another writer may still be filling it from a lap
+	// earlier, in which case we wait for it to finish. If it never does,
+	// its process is presumed dead and the slot is taken over.
+	uint64_t state = slot.state.load(std::memory_order_relaxed);
+	uint64_t waiting_on = 0;
+	std::chrono::steady_clock::time_point waiting_since;
+	while (true) {
+		if ((state & ~WRITING_BIT) > committedState(seq)) {
+			// A writer a full lap ahead already reused the slot. Readers
+			// will see this message as dropped.
+			return;
+		}
+		if ((state & WRITING_BIT) != 0) {
+			const auto now = std::chrono::steady_clock::now();
+			if (state != waiting_on) {
+				waiting_on = state;
+				waiting_since = now;
+			}
+			if ((now - waiting_since) < stale_write_timeout_) {
+				std::this_thread::yield();
+				state = slot.state.load(std::memory_order_relaxed);
+				continue;
+			}
+			// The writer has held the slot too long. Take it over below.
+		}
+		if (slot.state.compare_exchange_weak(
+		        state, committedState(seq) | WRITING_BIT,
+		        std::memory_order_acq_rel, std::memory_order_relaxed)) {
+			break;
+		}
+	}
+	std::atomic_thread_fence(std::memory_order_release);
+
+	// Serialized sizes were cached by the caller's ByteSizeLong()
+	message.SerializeWithCachedSizesToArray(slotData(slot));
+	slot.length.store(static_cast<uint32_t>(length),
+	                  std::memory_order_relaxed);
+	slot.state.store(committedState(seq), std::memory_order_release);
+}
+
+void SharedMemoryTransport::Ring::wakeReceivers() {
+	header_->wake_seq.fetch_add(1, std::memory_order_release);
+	if (header_->sleepers.load(std::memory_order_acquire) > 0) {
+		futexWakeAll(header_->wake_seq);
+	}
+}
+
+void SharedMemoryTransport::Ring::startReceiver(
+    std::function<void(const v1::UMessage&)>&& deliver) {
+	deliver_ = std::move(deliver);
+	running_ = true;
+	receiver_ = std::thread([this]() { receiveLoop(); });
+}
+
+void SharedMemoryTransport::Ring::stopReceiver() {
+	if (running_.exchange(false)) {
+		futexWakeAll(header_->wake_seq);
+	}
+	if (receiver_.joinable()) {
+		receiver_.join();
+	}
+}
+
+SharedMemoryTransport::Ring::ReadResult
+SharedMemoryTransport::Ring::readNext() {
+	auto& slot = slotAt(next_read_seq_);
+	const uint64_t expected = committedState(next_read_seq_);
+	const uint64_t state = slot.state.load(std::memory_order_acquire);
+
+	if (state == expected) {
+		const uint32_t length = slot.length.load(std::memory_order_relaxed);
+		const bool parsed = (length <= slot_size_) &&
+		                    received_.ParseFromArray(slotData(slot), length);
+		// Make sure the slot was not reused while we were parsing it
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const bool intact =
+		    slot.state.load(std::memory_order_relaxed) == expected;
+		++next_read_seq_;
+		if (parsed && intact) {
+			deliver_(received_);
+			return ReadResult::DELIVERED;
+		}
+		dropped_.fetch_add(1, std::memory_order_relaxed);
+		return ReadResult::SKIPPED;
+	}
+
+	if ((state & ~WRITING_BIT) > expected) {
+		// We have been lapped. Skip ahead to the oldest slot that could
+		// still hold unread data.
+		const uint64_t write_seq =
+		    header_->write_seq.load(std::memory_order_acquire);
+		const uint64_t oldest = (write_seq > slot_mask_ + 1)
+		                            ? write_seq - (slot_mask_ + 1)
+		                            : 0;
+		const uint64_t resume = std::max(next_read_seq_ + 1, oldest);
+		dropped_.fetch_add(resume - next_read_seq_, std::memory_order_relaxed);
+		next_read_seq_ = resume;
+		return ReadResult::SKIPPED;
+	}
+
+	return ReadResult::NOT_READY;
+}
+
+void SharedMemoryTransport::Ring::receiveLoop() {
+	const timespec wait_limit{0, RECEIVE_WAIT_NS};
+
+	while (running_) {
+		const uint32_t wake_seq =
+		    header_->wake_seq.load(std::memory_order_acquire);
+
+		if (readNext() != ReadResult::NOT_READY) {
+			continue;
+		}
+
+		header_->sleepers.fetch_add(1, std::memory_order_acq_rel);
+		// Re-check now that writers know to wake us up
+		if (running_ && (slotAt(next_read_seq_).state.load(
+		                     std::memory_order_acquire) ==
+		                 committedState(next_read_seq_))) {
+			header_->sleepers.fetch_sub(1, std::memory_order_acq_rel);
+			continue;
+		}
+		futexWait(header_->wake_seq, wake_seq, &wait_limit);
+		header_->sleepers.fetch_sub(1, std::memory_order_acq_rel);
+	}
+}
+
+SharedMemoryTransport::SharedMemoryTransport(const v1::UUri& defaultSource,
+                                             const Config& config)
+    : LoopbackTransport(defaultSource), ring_(std::make_unique<Ring>(config)) {
+	ring_->startReceiver(
+	    [this](const v1::UMessage& message) { dispatch(message); });
+}
+
+SharedMemoryTransport::~SharedMemoryTransport() {
+	// The receiver must be stopped before the listener index in the base
+	// class is destroyed.
+	ring_->stopReceiver();
+}
+
+bool SharedMemoryTransport::remove(const std::string& name) {
+	return shm_unlink(name.c_str()) == 0;
+}
+
+uint64_t SharedMemoryTransport::droppedCount() const {
+	return ring_->dropped_.load(std::memory_order_relaxed);
+}
+
+uint32_t SharedMemoryTransport::maxMessageSize() const {
+	return ring_->slot_size_;
+}
+
+v1::UStatus SharedMemoryTransport::sendImpl(const v1::UMessage& message) {
+	return ring_->write(message);
+}
+
+std::vector<v1::UStatus> SharedMemoryTransport::sendBatchImpl(
+    const v1::UMessage* messages, size_t count) {
+	return ring_->writeBatch(messages, count);
+}
+
+}  // namespace uprotocol::transport
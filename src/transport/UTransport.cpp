@@ -13,12 +13,17 @@
 
 #include "up-cpp/datamodel/validator/UMessage.h"
 #include "up-cpp/datamodel/validator/UUri.h"
+#include "up-cpp/datamodel/validator/Uuid.h"
 #include "up-cpp/utils/Expected.h"
 
+#include <algorithm>
+#include <string>
+
 namespace uprotocol::transport {
 
 namespace UriValidator = uprotocol::datamodel::validator::uri;
 namespace MessageValidator = uprotocol::datamodel::validator::message;
+namespace UuidValidator = uprotocol::datamodel::validator::uuid;
 
 UTransport::UTransport(const v1::UUri& defaultSrc)
     : defaultSource_(defaultSrc) {
@@ -31,21 +36,108 @@ UTransport::UTransport(const v1::UUri& defaultSrc)
 }
 
 v1::UStatus UTransport::send(const v1::UMessage& message) {
-	auto [msgOk, reason] = MessageValidator::isValid(message);
-	if (!msgOk) {
+	return send(message, validationPolicy_.load(std::memory_order_relaxed));
+}
+
+v1::UStatus UTransport::send(const v1::UMessage& message,
+                             ValidationPolicy policy) {
+	validate(message, policy);
+	return sendImpl(message);
+}
+
+std::vector<v1::UStatus> UTransport::sendBatch(const v1::UMessage* messages,
+                                               size_t count) {
+	if (count == 0) {
+		return {};
+	}
+
+	const auto policy = validationPolicy_.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < count; ++i) {
+		try {
+			validate(messages[i], policy);
+		} catch (const MessageValidator::InvalidUMessage& e) {
+			throw MessageValidator::InvalidUMessage(
+			    "Batch message " + std::to_string(i) + " | " + e.what());
+		}
+	}
+
+	return sendBatchImpl(messages, count);
+}
+
+std::vector<v1::UStatus> UTransport::sendBatch(
+    const std::vector<v1::UMessage>& messages) {
+	return sendBatch(messages.data(), messages.size());
+}
+
+void UTransport::setValidationPolicy(ValidationPolicy policy,
+                                     size_t sample_interval) {
+	sampleInterval_ = std::max<size_t>(sample_interval, 1);
+	validationPolicy_ = policy;
+}
+
+UTransport::ValidationPolicy UTransport::getValidationPolicy() const {
+	return validationPolicy_;
+}
+
+UTransport::ValidationStats UTransport::getValidationStats() const {
+	ValidationStats stats;
+	stats.validated = validatedCount_.load(std::memory_order_relaxed);
+	stats.skipped = skippedCount_.load(std::memory_order_relaxed);
+	stats.rejected = rejectedCount_.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void UTransport::validate(const v1::UMessage& message,
+                          ValidationPolicy policy) {
+	bool full_check = true;
+	switch (policy) {
+		case ValidationPolicy::SAMPLED:
+			full_check = (sampleCounter_.fetch_add(
+			                  1, std::memory_order_relaxed) %
+			              sampleInterval_.load(std::memory_order_relaxed)) ==
+			             0;
+			break;
+		case ValidationPolicy::TRUSTED:
+		case ValidationPolicy::OFF:
+			full_check = false;
+			break;
+		default:
+			break;
+	}
+
+	std::optional<MessageValidator::Reason> failure;
+	if (full_check) {
+		validatedCount_.fetch_add(1, std::memory_order_relaxed);
+		auto [msgOk, reason] = MessageValidator::isValid(message);
+		if (!msgOk) {
+			failure = reason;
+		}
+	} else {
+		skippedCount_.fetch_add(1, std::memory_order_relaxed);
+		const auto& attributes = message.attributes();
+		if ((policy == ValidationPolicy::TRUSTED) && attributes.has_ttl() &&
+		    (attributes.ttl() > 0)) {
+			auto [expired, reason] = UuidValidator::isExpired(
+			    attributes.id(), std::chrono::milliseconds(attributes.ttl()));
+			if (expired) {
+				failure = MessageValidator::Reason::ID_EXPIRED;
+			}
+		}
+	}
+
+	if (failure) {
+		rejectedCount_.fetch_add(1, std::memory_order_relaxed);
 		throw MessageValidator::InvalidUMessage(
 		    "Invalid UMessage | " +
-		    std::string(MessageValidator::message(*reason)));
+		    std::string(MessageValidator::message(*failure)));
 	}
-
-	return sendImpl(message);
 }
 
 utils::Expected<UTransport::ListenHandle, v1::UStatus>
 UTransport::registerListener(const v1::UUri& sink_filter,
                              ListenCallback&& listener,
                              std::optional<v1::UUri>&& source_filter) {
-	auto [sinkOk, reason1] = UriValidator::isValid(sink_filter);
+	auto [sinkOk, reason1] = UriValidator::isValidFilter(sink_filter);
 	if (!sinkOk) {
 		throw UriValidator::InvalidUUri(
 		    "sink_filter is not a valid URI |  " +
@@ -53,7 +145,8 @@ UTransport::registerListener(const v1::UUri& sink_filter,
 	}
 
 	if (source_filter.has_value()) {
-		auto [srcOk, reason2] = UriValidator::isValid(source_filter.value());
+		auto [srcOk, reason2] =
+		    UriValidator::isValidFilter(source_filter.value());
 		if (!srcOk) {
 			throw UriValidator::InvalidUUri(
 			    "source_filter is not a valid URI |  " +
@@ -76,6 +169,16 @@ UTransport::registerListener(const v1::UUri& sink_filter,
 
 const v1::UUri& UTransport::getDefaultSource() const { return defaultSource_; }
 
+std::vector<v1::UStatus> UTransport::sendBatchImpl(
+    const v1::UMessage* messages, size_t count) {
+	std::vector<v1::UStatus> statuses;
+	statuses.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		statuses.push_back(sendImpl(messages[i]));
+	}
+	return statuses;
+}
+
 void UTransport::cleanupListener(CallableConn listener) {}
 
 }  // namespace uprotocol::transport
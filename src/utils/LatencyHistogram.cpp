@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace uprotocol::utils {
+
+using std::chrono::nanoseconds;
+
+nanoseconds LatencyHistogram::Snapshot::upperBound(size_t bucket) {
+	if (bucket >= NUM_BUCKETS - 1) {
+		return nanoseconds::max();
+	}
+	return std::chrono::microseconds(uint64_t{1} << bucket);
+}
+
+nanoseconds LatencyHistogram::Snapshot::mean() const {
+	if (count == 0) {
+		return nanoseconds(0);
+	}
+	return total / count;
+}
+
+nanoseconds LatencyHistogram::Snapshot::percentile(double fraction) const {
+	if (count == 0) {
+		return nanoseconds(0);
+	}
+
+	fraction = std::clamp(fraction, 0.0, 1.0);
+	// Rank of the percentile, counting from 1
+	const auto rank = std::max<uint64_t>(
+	    1, static_cast<uint64_t>(std::ceil(fraction * double(count))));
+
+	uint64_t seen = 0;
+	for (size_t bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+		seen += buckets[bucket];
+		if (seen >= rank) {
+			return std::min(upperBound(bucket), max);
+		}
+	}
+	// Only reachable if the snapshot was taken mid-record
+	return max;
+}
+
+size_t LatencyHistogram::bucketOf(nanoseconds duration) {
+	auto micros = static_cast<uint64_t>(
+	    std::max<int64_t>(0, duration.count()) / 1000);
+	size_t bucket = 0;
+	while ((micros != 0) && (bucket < NUM_BUCKETS - 1)) {
+		micros >>= 1;
+		++bucket;
+	}
+	return bucket;
+}
+
+void LatencyHistogram::record(nanoseconds duration) {
+	const int64_t ns = std::max<int64_t>(0, duration.count());
+	buckets_[bucketOf(duration)].fetch_add(1, std::memory_order_relaxed);
+	count_.fetch_add(1, std::memory_order_relaxed);
+	total_ns_.fetch_add(ns, std::memory_order_relaxed);
+
+	auto max = max_ns_.load(std::memory_order_relaxed);
+	while ((ns > max) && !max_ns_.compare_exchange_weak(
+	                         max, ns, std::memory_order_relaxed)) {
+	}
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const {
+	Snapshot snapshot;
+	for (size_t bucket = 0; bucket < NUM_BUCKETS; ++bucket) {
+		snapshot.buckets[bucket] =
+		    buckets_[bucket].load(std::memory_order_relaxed);
+	}
+	snapshot.count = count_.load(std::memory_order_relaxed);
+	snapshot.total = nanoseconds(total_ns_.load(std::memory_order_relaxed));
+	snapshot.max = nanoseconds(max_ns_.load(std::memory_order_relaxed));
+	return snapshot;
+}
+
+}  // namespace uprotocol::utils
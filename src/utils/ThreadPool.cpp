@@ -10,3 +10,228 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "up-cpp/utils/ThreadPool.h"
+
+#include <algorithm>
+
+namespace uprotocol::utils {
+
+namespace {
+/// @brief Pool that the current thread is a worker of, if any
+thread_local const ThreadPool* current_pool = nullptr;
+/// @brief Index of the current thread within current_pool
+thread_local size_t current_worker = 0;
+}  // namespace
+
+ThreadPool::ThreadPool(const size_t max_queue_size,
+                       const size_t max_num_of_threads,
+                       std::chrono::milliseconds task_timeout,
+                       Scheduling scheduling)
+    : queue_(max_queue_size),
+      terminate_(false),
+      maxNumOfThreads_(std::max<size_t>(max_num_of_threads, 1)),
+      numOfThreads_(0),
+      timeout_(task_timeout),
+      scheduling_(scheduling),
+      maxQueueSize_(max_queue_size) {
+	if (scheduling_ == Scheduling::WORK_STEALING) {
+		// All deques must exist before any worker can try to steal from them
+		for (size_t i = 0; i < maxNumOfThreads_; ++i) {
+			workerQueues_.push_back(std::make_unique<WorkerQueue>());
+		}
+
+		std::lock_guard lock(mutex_);
+		for (size_t i = 0; i < maxNumOfThreads_; ++i) {
+			threads_.push_back(std::async(std::launch::async,
+			                              [this, i]() { stealingWorker(i); }));
+		}
+		numOfThreads_ = maxNumOfThreads_;
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	terminate_ = true;
+
+	if (scheduling_ == Scheduling::WORK_STEALING) {
+		{ std::lock_guard lock(idleMutex_); }
+		idleCondition_.notify_all();
+	} else {
+		// Wakes workers waiting on the queue so they can see that the pool
+		// is terminating. Pushing wake-up tasks instead could evict real
+		// tasks from a full queue.
+		queue_.interrupt();
+	}
+
+	// Waiting happens without the lock held so that a running task can still
+	// call submit(). No new workers are started once terminate_ is set.
+	std::vector<std::future<void>> threads;
+	{
+		std::lock_guard lock(mutex_);
+		threads = std::move(threads_);
+	}
+	for (auto& thread : threads) {
+		if (thread.valid()) {
+			thread.wait();
+		}
+	}
+}
+
+void ThreadPool::enqueue(Task&& task) {
+	if (scheduling_ == Scheduling::WORK_STEALING) {
+		if (current_pool == this) {
+			// Destroyed after unlocking, as it may submit another task
+			Task evicted;
+			auto& local = *workerQueues_[current_worker];
+			std::lock_guard lock(local.mutex);
+			if (!local.tasks.empty() && (local.tasks.size() >= maxQueueSize_)) {
+				evicted = std::move(local.tasks.front());
+				local.tasks.pop_front();
+			}
+			local.tasks.push_back(std::move(task));
+		} else {
+			queue_.push(std::move(task));
+		}
+		wakeIdleWorker();
+		return;
+	}
+
+	queue_.push(std::move(task));
+
+	// Pairs with the fence in sharedWorker() when a worker is exiting. Either
+	// the worker sees this task, or we see that it has exited.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (numOfThreads_.load() < maxNumOfThreads_) {
+		startSharedWorker();
+	}
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SHARED_QUEUE mode
+
+void ThreadPool::startSharedWorker() {
+	std::lock_guard lock(mutex_);
+	if (terminate_) {
+		return;
+	}
+
+	if (numOfThreads_.fetch_add(1) >= maxNumOfThreads_) {
+		numOfThreads_.fetch_sub(1);
+		return;
+	}
+
+	// Drop the futures of workers that have already exited
+	threads_.erase(std::remove_if(threads_.begin(), threads_.end(),
+	                              [](const std::future<void>& thread) {
+		                              return thread.wait_for(
+		                                         std::chrono::seconds(0)) ==
+		                                     std::future_status::ready;
+	                              }),
+	               threads_.end());
+
+	threads_.push_back(
+	    std::async(std::launch::async, [this]() { sharedWorker(); }));
+}
+
+void ThreadPool::sharedWorker() {
+	Task task;
+	while (!terminate_) {
+		if (queue_.tryPopFor(task, timeout_)) {
+			task();
+			task = nullptr;
+			continue;
+		}
+
+		// Idle for too long - exit, unless a task arrived just as this worker
+		// timed out and the submitter still counted it as running.
+		numOfThreads_.fetch_sub(1);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (terminate_ || queue_.isEmpty()) {
+			return;
+		}
+
+		size_t count = numOfThreads_.load();
+		do {
+			if (count >= maxNumOfThreads_) {
+				// Another worker has been started to handle it
+				return;
+			}
+		} while (!numOfThreads_.compare_exchange_weak(count, count + 1));
+	}
+	numOfThreads_.fetch_sub(1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// WORK_STEALING mode
+
+void ThreadPool::stealingWorker(size_t index) {
+	current_pool = this;
+	current_worker = index;
+
+	Task task;
+	while (!terminate_) {
+		if (popLocal(index, task) || queue_.tryPop(task) ||
+		    steal(index, task)) {
+			task();
+			task = nullptr;
+			continue;
+		}
+
+		std::unique_lock lock(idleMutex_);
+		idleWorkers_.fetch_add(1);
+		// Pairs with the fence in wakeIdleWorker()
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (!terminate_ && !hasQueuedWork()) {
+			idleCondition_.wait_for(lock, timeout_);
+		}
+		idleWorkers_.fetch_sub(1);
+	}
+
+	current_pool = nullptr;
+}
+
+bool ThreadPool::popLocal(size_t index, Task& task) {
+	auto& local = *workerQueues_[index];
+	std::lock_guard lock(local.mutex);
+	if (local.tasks.empty()) {
+		return false;
+	}
+	// Newest first - its data is the most likely to still be in cache
+	task = std::move(local.tasks.back());
+	local.tasks.pop_back();
+	return true;
+}
+
+bool ThreadPool::steal(size_t thief, Task& task) {
+	const size_t num_workers = workerQueues_.size();
+	for (size_t offset = 1; offset < num_workers; ++offset) {
+		auto& victim = *workerQueues_[(thief + offset) % num_workers];
+		std::lock_guard lock(victim.mutex);
+		if (!victim.tasks.empty()) {
+			// Oldest first, leaving the owner its most recent work
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ThreadPool::hasQueuedWork() {
+	if (!queue_.isEmpty()) {
+		return true;
+	}
+	return std::any_of(workerQueues_.begin(), workerQueues_.end(),
+	                   [](const std::unique_ptr<WorkerQueue>& worker) {
+		                   std::lock_guard lock(worker->mutex);
+		                   return !worker->tasks.empty();
+	                   });
+}
+
+void ThreadPool::wakeIdleWorker() {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (idleWorkers_.load(std::memory_order_relaxed) > 0) {
+		{ std::lock_guard lock(idleMutex_); }
+		idleCondition_.notify_one();
+	}
+}
+
+}  // namespace uprotocol::utils
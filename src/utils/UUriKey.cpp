@@ -0,0 +1,159 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "up-cpp/utils/UUriKey.h"
+
+#include <mutex>
+#include <stdexcept>
+
+namespace uprotocol::utils {
+
+namespace {
+constexpr uint32_t SERVICE_ID_MASK = 0x0000FFFF;
+constexpr uint32_t INSTANCE_ID_MASK = 0xFFFF0000;
+constexpr uint32_t MAX_VERSION = 0xFF;
+constexpr uint32_t MAX_RESOURCE_ID = 0xFFFF;
+
+/// @brief Finalizer from splitmix64. Spreads the packed fields across all
+///        bits of the hash.
+uint64_t mix(uint64_t value) {
+	value ^= value >> 30;
+	value *= 0xBF58476D1CE4E5B9ULL;
+	value ^= value >> 27;
+	value *= 0x94D049BB133111EBULL;
+	value ^= value >> 31;
+	return value;
+}
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// AuthorityTable
+
+AuthorityTable::AuthorityTable() {
+	intern("");
+	intern("*");
+}
+
+AuthorityTable::Id AuthorityTable::intern(std::string_view name) {
+	{
+		std::shared_lock lock(mutex_);
+		if (auto found = ids_.find(name); found != ids_.end()) {
+			return found->second;
+		}
+	}
+
+	std::unique_lock lock(mutex_);
+	// Another thread may have added it while the lock was released
+	if (auto found = ids_.find(name); found != ids_.end()) {
+		return found->second;
+	}
+	const auto id = static_cast<Id>(entries_.size());
+	entries_.push_back(
+	    {std::string(name), name.find('*') != std::string_view::npos});
+	ids_.emplace(entries_.back().name, id);
+	return id;
+}
+
+std::optional<AuthorityTable::Id> AuthorityTable::find(
+    std::string_view name) const {
+	std::shared_lock lock(mutex_);
+	if (auto found = ids_.find(name); found != ids_.end()) {
+		return found->second;
+	}
+	return std::nullopt;
+}
+
+std::string_view AuthorityTable::name(Id id) const {
+	std::shared_lock lock(mutex_);
+	return entries_.at(id).name;
+}
+
+bool AuthorityTable::hasWildcard(Id id) const {
+	std::shared_lock lock(mutex_);
+	return entries_.at(id).has_wildcard;
+}
+
+size_t AuthorityTable::size() const {
+	std::shared_lock lock(mutex_);
+	return entries_.size();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// UUriKey
+
+UUriKey::UUriKey(const v1::UUri& uri, AuthorityTable& table)
+    : authority_(table.intern(uri.authority_name())) {
+	if (uri.ue_version_major() > MAX_VERSION) {
+		throw std::invalid_argument("UUri major version out of range");
+	}
+	if (uri.resource_id() > MAX_RESOURCE_ID) {
+		throw std::invalid_argument("UUri resource ID out of range");
+	}
+
+	fields_ = (static_cast<uint64_t>(uri.ue_id()) << UE_ID_SHIFT) |
+	          (static_cast<uint64_t>(uri.ue_version_major()) << VERSION_SHIFT) |
+	          uri.resource_id();
+	hash_ = static_cast<size_t>(mix(fields_ ^ mix(authority_)));
+
+	if (table.hasWildcard(authority_)) {
+		wildcards_ |= AUTHORITY_WILDCARD;
+	}
+	if ((uri.ue_id() & SERVICE_ID_MASK) == SERVICE_ID_MASK) {
+		wildcards_ |= SERVICE_WILDCARD;
+	}
+	if ((uri.ue_id() & INSTANCE_ID_MASK) == 0) {
+		wildcards_ |= INSTANCE_WILDCARD;
+	}
+	if (uri.ue_version_major() == MAX_VERSION) {
+		wildcards_ |= VERSION_WILDCARD;
+	}
+	if (uri.resource_id() == MAX_RESOURCE_ID) {
+		wildcards_ |= RESOURCE_WILDCARD;
+	}
+}
+
+bool UUriKey::matches(const UUriKey& concrete) const {
+	if (wildcards_ == 0) {
+		return *this == concrete;
+	}
+	// Only a bare "*" matches any authority
+	if ((authority_ != AuthorityTable::WILDCARD) &&
+	    (authority_ != concrete.authority_)) {
+		return false;
+	}
+
+	// Compare only the bits of fields_ that are not wildcarded
+	uint64_t mask = ~uint64_t{0};
+	if (wildcards_ & SERVICE_WILDCARD) {
+		mask &= ~(static_cast<uint64_t>(SERVICE_ID_MASK) << UE_ID_SHIFT);
+	}
+	if (wildcards_ & INSTANCE_WILDCARD) {
+		mask &= ~(static_cast<uint64_t>(INSTANCE_ID_MASK) << UE_ID_SHIFT);
+	}
+	if (wildcards_ & VERSION_WILDCARD) {
+		mask &= ~(static_cast<uint64_t>(MAX_VERSION) << VERSION_SHIFT);
+	}
+	if (wildcards_ & RESOURCE_WILDCARD) {
+		mask &= ~static_cast<uint64_t>(MAX_RESOURCE_ID);
+	}
+	return (fields_ & mask) == (concrete.fields_ & mask);
+}
+
+v1::UUri UUriKey::toUUri(const AuthorityTable& table) const {
+	v1::UUri uri;
+	uri.set_authority_name(std::string(table.name(authority_)));
+	uri.set_ue_id(ueId());
+	uri.set_ue_version_major(version());
+	uri.set_resource_id(resourceId());
+	return uri;
+}
+
+}  // namespace uprotocol::utils
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+// Replaces every form of the global operator new and delete so that all
+// allocations are counted. Allocation and deallocation both go through
+// malloc and free, so any new can be paired with any delete.
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "AllocationCounter.h"
+
+namespace {
+std::atomic<size_t> allocations{0};
+
+void* allocate(std::size_t size) noexcept {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	return std::malloc(size == 0 ? 1 : size);
+}
+
+void* allocate(std::size_t size, std::align_val_t align) noexcept {
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	const auto alignment = static_cast<std::size_t>(align);
+	// aligned_alloc() requires the size to be a multiple of the alignment
+	const std::size_t rounded =
+	    ((size == 0 ? 1 : size) + alignment - 1) / alignment * alignment;
+	return std::aligned_alloc(alignment, rounded);
+}
+
+template <typename... Align>
+void* allocateOrThrow(std::size_t size, Align... align) {
+	if (void* ptr = allocate(size, align...)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+}  // namespace
+
+size_t uprotocol::test::allocationCount() noexcept {
+	return allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) { return allocateOrThrow(size); }
+
+void* operator new[](std::size_t size) { return allocateOrThrow(size); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+	return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align) {
+	return allocateOrThrow(size, align);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align) {
+	return allocateOrThrow(size, align);
+}
+
+void* operator new(std::size_t size, std::align_val_t align,
+                   const std::nothrow_t&) noexcept {
+	return allocate(size, align);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align,
+                     const std::nothrow_t&) noexcept {
+	return allocate(size, align);
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept {
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t,
+                     const std::nothrow_t&) noexcept {
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t,
+                       const std::nothrow_t&) noexcept {
+	std::free(ptr);
+}
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/utils/CyclicQueue.h>
+#include <up-cpp/utils/LockFreeCyclicQueue.h>
+
+#include <functional>
+
+namespace {
+using uprotocol::utils::CyclicQueue;
+using uprotocol::utils::LockFreeCyclicQueue;
+
+constexpr size_t QUEUE_SIZE = 1024;
+
+/// @brief One queue shared by all threads of a benchmark run
+template <typename Queue>
+Queue& sharedQueue() {
+	static Queue queue(QUEUE_SIZE);
+	return queue;
+}
+
+/// @brief Every thread both pushes and pops, so all threads contend on both
+///        ends of the queue.
+template <typename Queue, typename T>
+void BM_PushPop(benchmark::State& state) {
+	auto& queue = sharedQueue<Queue>();
+	if (state.thread_index() == 0) {
+		queue.clear();
+	}
+
+	T value{};
+	for (auto _ : state) {
+		queue.push(value);
+		benchmark::DoNotOptimize(queue.tryPop(value));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+/// @brief Half the threads produce and half consume, as in a thread pool
+///        with several submitters.
+template <typename Queue, typename T>
+void BM_ProducerConsumer(benchmark::State& state) {
+	auto& queue = sharedQueue<Queue>();
+	if (state.thread_index() == 0) {
+		queue.clear();
+	}
+
+	const bool producer = (state.thread_index() % 2) == 0;
+	T value{};
+	for (auto _ : state) {
+		if (producer) {
+			queue.push(value);
+		} else {
+			benchmark::DoNotOptimize(queue.tryPop(value));
+		}
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+using TaskFn = std::function<void()>;
+
+BENCHMARK_TEMPLATE(BM_PushPop, CyclicQueue<int>, int)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPop, LockFreeCyclicQueue<int>, int)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPop, CyclicQueue<TaskFn>, TaskFn)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PushPop, LockFreeCyclicQueue<TaskFn>, TaskFn)
+    ->ThreadRange(1, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducerConsumer, CyclicQueue<int>, int)
+    ->ThreadRange(2, 32)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ProducerConsumer, LockFreeCyclicQueue<int>, int)
+    ->ThreadRange(2, 32)
+    ->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/utils/Future.h>
+
+#include <future>
+#include <thread>
+
+#include "AllocationCounter.h"
+
+namespace {
+using uprotocol::test::AllocationCounter;
+using uprotocol::utils::Future;
+using uprotocol::utils::Promise;
+
+/// @brief Value is set before it is waited on (e.g. a request that failed
+///        to send).
+void BM_StdReadyGet(benchmark::State& state) {
+	AllocationCounter counter(state, "allocs/op");
+	for (auto _ : state) {
+		std::promise<int> promise;
+		auto future = promise.get_future();
+		promise.set_value(1);
+		benchmark::DoNotOptimize(future.get());
+	}
+}
+
+void BM_PooledReadyGet(benchmark::State& state) {
+	AllocationCounter counter(state, "allocs/op");
+	for (auto _ : state) {
+		Promise<int> promise;
+		auto future = promise.getFuture();
+		promise.setValue(1);
+		benchmark::DoNotOptimize(future.get());
+	}
+}
+
+/// @brief Continuation attached before the value is set. std::future has no
+///        continuations, so its equivalent is a callback wrapping a promise.
+void BM_StdCallback(benchmark::State& state) {
+	AllocationCounter counter(state, "allocs/op");
+	for (auto _ : state) {
+		auto promise = std::make_shared<std::promise<int>>();
+		auto future = promise->get_future();
+		std::function<void(int)> callback = [promise](int value) {
+			promise->set_value(value);
+		};
+		callback(1);
+		benchmark::DoNotOptimize(future.get());
+	}
+}
+
+void BM_PooledThen(benchmark::State& state) {
+	AllocationCounter counter(state, "allocs/op");
+	int sum = 0;
+	for (auto _ : state) {
+		Promise<int> promise;
+		promise.getFuture().then([&sum](int value) { sum += value; });
+		promise.setValue(1);
+	}
+	benchmark::DoNotOptimize(sum);
+}
+
+/// @brief Value set on another thread while the caller blocks in get().
+template <typename PromiseT>
+void pingPong(benchmark::State& state) {
+	std::atomic<PromiseT*> pending{nullptr};
+	std::atomic<bool> stop{false};
+	std::thread setter([&]() {
+		while (!stop.load(std::memory_order_relaxed)) {
+			if (auto* promise = pending.exchange(nullptr)) {
+				if constexpr (std::is_same_v<PromiseT, Promise<int>>) {
+					promise->setValue(1);
+				} else {
+					promise->set_value(1);
+				}
+			}
+		}
+	});
+
+	{
+		AllocationCounter counter(state, "allocs/op");
+		for (auto _ : state) {
+			PromiseT promise;
+			if constexpr (std::is_same_v<PromiseT, Promise<int>>) {
+				auto future = promise.getFuture();
+				pending.store(&promise);
+				benchmark::DoNotOptimize(future.get());
+			} else {
+				auto future = promise.get_future();
+				pending.store(&promise);
+				benchmark::DoNotOptimize(future.get());
+			}
+		}
+	}
+
+	stop = true;
+	setter.join();
+}
+
+void BM_StdCrossThread(benchmark::State& state) {
+	pingPong<std::promise<int>>(state);
+}
+
+void BM_PooledCrossThread(benchmark::State& state) {
+	pingPong<Promise<int>>(state);
+}
+
+BENCHMARK(BM_StdReadyGet);
+BENCHMARK(BM_PooledReadyGet);
+BENCHMARK(BM_StdCallback);
+BENCHMARK(BM_PooledThen);
+BENCHMARK(BM_StdCrossThread)->UseRealTime();
+BENCHMARK(BM_PooledCrossThread)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/transport/AsyncSender.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::transport::AsyncSender;
+using Policy = AsyncSender::Scheduler::Policy;
+
+/// @brief Transport that takes a fixed amount of time to send each message
+class SlowTransport : public transport::UTransport {
+public:
+	explicit SlowTransport(const v1::UUri& uri) : UTransport(uri) {}
+
+private:
+	[[nodiscard]] v1::UStatus sendImpl(const v1::UMessage&) override {
+		auto until = std::chrono::steady_clock::now() + 2us;
+		while (std::chrono::steady_clock::now() < until) {
+		}
+		return {};
+	}
+
+	[[nodiscard]] v1::UStatus registerListenerImpl(
+	    const v1::UUri&, CallableConn&&, std::optional<v1::UUri>&&) override {
+		return {};
+	}
+};
+
+v1::UUri makeUri(uint32_t resource_id) {
+	v1::UUri uri;
+	uri.set_authority_name("10.0.0.1");
+	uri.set_ue_id(0x00010001);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+/// @brief Latency of a single message sent while another thread keeps the
+///        outbound queue full of CS0 telemetry.
+///
+/// Arguments: priority of the measured message, and scheduling policy. With
+/// a CS0 measured message, it waits behind the whole queue like it would
+/// with no priority scheduling.
+void BM_LatencyUnderFlood(benchmark::State& state) {
+	const auto priority = static_cast<v1::UPriority>(state.range(0));
+	const auto policy = static_cast<Policy>(state.range(1));
+
+	auto transport = std::make_shared<SlowTransport>(makeUri(0));
+	AsyncSender sender(transport, 256, AsyncSender::Backpressure::BLOCK,
+	                   policy);
+
+	auto flood_builder = UMessageBuilder::publish(makeUri(0x8001));
+	flood_builder.withPriority(v1::UPRIORITY_CS0);
+	std::atomic<bool> flooding{true};
+	std::thread flood([&]() {
+		while (flooding) {
+			sender.sendAsync(flood_builder.build(), [](v1::UStatus) {});
+		}
+	});
+	while (sender.queueSize() < 256) {
+		std::this_thread::yield();
+	}
+
+	auto builder = UMessageBuilder::publish(makeUri(0x8002));
+	builder.withPriority(priority);
+	std::vector<double> latencies;
+
+	for (auto _ : state) {
+		auto start = std::chrono::steady_clock::now();
+		auto future = sender.sendAsync(builder.build());
+		future.wait();
+		latencies.push_back(std::chrono::duration<double, std::micro>(
+		                        std::chrono::steady_clock::now() - start)
+		                        .count());
+	}
+
+	flooding = false;
+	flood.join();
+
+	std::sort(latencies.begin(), latencies.end());
+	auto percentile = [&latencies](double p) {
+		return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+	};
+	state.counters["p50_us"] = percentile(0.50);
+	state.counters["p99_us"] = percentile(0.99);
+	state.counters["max_us"] = latencies.back();
+}
+
+BENCHMARK(BM_LatencyUnderFlood)
+    ->ArgNames({"priority", "wfq"})
+    ->Args({v1::UPRIORITY_CS0, static_cast<int64_t>(Policy::STRICT)})
+    ->Args({v1::UPRIORITY_CS6, static_cast<int64_t>(Policy::STRICT)})
+    ->Args({v1::UPRIORITY_CS6, static_cast<int64_t>(Policy::WEIGHTED_FAIR)})
+    ->Iterations(2000)
+    ->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/communication/RpcClient.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/transport/LoopbackTransport.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::communication::RpcClient;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::transport::LoopbackTransport;
+
+/// @brief Sequential calls made by each concurrent flow per iteration
+constexpr int CALLS_PER_FLOW = 8;
+
+v1::UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+	v1::UUri uri;
+	uri.set_authority_name("10.0.0.1");
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+/// @brief Answers requests on a LoopbackTransport from its own threads, so
+///        that responses arrive asynchronously as they would from a remote
+///        service.
+class EchoServer {
+public:
+	EchoServer(std::shared_ptr<LoopbackTransport> transport,
+	           const v1::UUri& method, size_t threads)
+	    : transport_(std::move(transport)) {
+		auto handle = transport_->registerListener(
+		    method, [this](const v1::UMessage& request) {
+			    {
+				    std::lock_guard lock(mutex_);
+				    requests_.push_back(request);
+			    }
+			    wake_.notify_one();
+		    });
+		handle_ = std::move(handle).value();
+
+		for (size_t i = 0; i < threads; ++i) {
+			threads_.emplace_back([this]() { run(); });
+		}
+	}
+
+	~EchoServer() {
+		{
+			std::lock_guard lock(mutex_);
+			stop_ = true;
+		}
+		wake_.notify_all();
+		for (auto& thread : threads_) {
+			thread.join();
+		}
+	}
+
+private:
+	void run() {
+		while (true) {
+			v1::UMessage request;
+			{
+				std::unique_lock lock(mutex_);
+				wake_.wait(lock,
+				           [this]() { return stop_ || !requests_.empty(); });
+				if (stop_) {
+					return;
+				}
+				request = std::move(requests_.front());
+				requests_.pop_front();
+			}
+			auto status =
+			    transport_->send(UMessageBuilder::response(request).build());
+			benchmark::DoNotOptimize(status);
+		}
+	}
+
+	std::shared_ptr<LoopbackTransport> transport_;
+	transport::UTransport::ListenHandle handle_;
+	std::mutex mutex_;
+	std::condition_variable wake_;
+	std::deque<v1::UMessage> requests_;
+	bool stop_{false};
+	std::vector<std::thread> threads_;
+};
+
+/// @brief Counts finished flows and lets the benchmark thread wait for them
+class Completion {
+public:
+	void reset(int64_t expected) {
+		std::lock_guard lock(mutex_);
+		remaining_ = expected;
+	}
+
+	void done() {
+		std::lock_guard lock(mutex_);
+		if (--remaining_ == 0) {
+			finished_.notify_one();
+		}
+	}
+
+	void wait() {
+		std::unique_lock lock(mutex_);
+		finished_.wait(lock, [this]() { return remaining_ == 0; });
+	}
+
+private:
+	std::mutex mutex_;
+	std::condition_variable finished_;
+	int64_t remaining_{0};
+};
+
+struct Fixture {
+	Fixture()
+	    : transport(
+	          std::make_shared<LoopbackTransport>(makeUri(0x00010001, 0))),
+	      server(transport, makeUri(0x00010002, 0x0101), 2),
+	      client(transport, makeUri(0x00010002, 0x0101), v1::UPRIORITY_CS4,
+	             1000ms) {}
+
+	std::shared_ptr<LoopbackTransport> transport;
+	EchoServer server;
+	RpcClient client;
+};
+
+/// @brief One thread per flow, each blocking on the future of every call.
+void BM_Future(benchmark::State& state) {
+	Fixture fixture;
+	const auto flows = state.range(0);
+
+	for (auto _ : state) {
+		std::vector<std::thread> threads;
+		threads.reserve(flows);
+		for (int64_t i = 0; i < flows; ++i) {
+			threads.emplace_back([&fixture]() {
+				for (int call = 0; call < CALLS_PER_FLOW; ++call) {
+					auto result = fixture.client.invokeMethod().get();
+					benchmark::DoNotOptimize(result);
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * flows * CALLS_PER_FLOW);
+}
+
+/// @brief All flows started from one thread, each callback making the
+///        flow's next call.
+void BM_Callback(benchmark::State& state) {
+	Fixture fixture;
+	const auto flows = state.range(0);
+	Completion completion;
+
+	struct Flow {
+		RpcClient& client;
+		Completion& completion;
+		int remaining{CALLS_PER_FLOW};
+
+		void next() {
+			client.invokeMethod([this](RpcClient::MessageOrStatus result) {
+				benchmark::DoNotOptimize(result);
+				if (--remaining == 0) {
+					completion.done();
+				} else {
+					next();
+				}
+			});
+		}
+	};
+
+	for (auto _ : state) {
+		completion.reset(flows);
+		std::vector<std::unique_ptr<Flow>> running;
+		running.reserve(flows);
+		for (int64_t i = 0; i < flows; ++i) {
+			running.push_back(
+			    std::make_unique<Flow>(Flow{fixture.client, completion}));
+			running.back()->next();
+		}
+		completion.wait();
+	}
+	state.SetItemsProcessed(state.iterations() * flows * CALLS_PER_FLOW);
+}
+
+BENCHMARK(BM_Future)->Arg(16)->Arg(256)->Arg(1024)->UseRealTime();
+BENCHMARK(BM_Callback)->Arg(16)->Arg(256)->Arg(1024)->UseRealTime();
+
+#ifdef UP_CPP_ENABLE_COROUTINES
+/// @brief Eagerly started coroutine that nobody waits on
+struct Detached {
+	struct promise_type {
+		Detached get_return_object() { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+};
+
+Detached coroutineFlow(RpcClient& client, utils::ThreadPool* executor,
+                       Completion& completion) {
+	for (int call = 0; call < CALLS_PER_FLOW; ++call) {
+		auto result = co_await client.invokeMethodAsync(executor);
+		benchmark::DoNotOptimize(result);
+	}
+	completion.done();
+}
+
+/// @brief All flows started from one thread as coroutines, each awaiting
+///        its calls in sequence. With a second argument of 1, coroutines are
+///        resumed on a ThreadPool rather than on the responding thread.
+void BM_Coroutine(benchmark::State& state) {
+	Fixture fixture;
+	const auto flows = state.range(0);
+	std::unique_ptr<utils::ThreadPool> pool;
+	if (state.range(1) != 0) {
+		pool = std::make_unique<utils::ThreadPool>(
+		    4096, 4, 1000ms, utils::ThreadPool::Scheduling::WORK_STEALING);
+	}
+	Completion completion;
+
+	for (auto _ : state) {
+		completion.reset(flows);
+		for (int64_t i = 0; i < flows; ++i) {
+			coroutineFlow(fixture.client, pool.get(), completion);
+		}
+		completion.wait();
+	}
+	state.SetItemsProcessed(state.iterations() * flows * CALLS_PER_FLOW);
+}
+
+BENCHMARK(BM_Coroutine)
+    ->ArgNames({"flows", "pool"})
+    ->ArgsProduct({{16, 256, 1024}, {0, 1}})
+    ->UseRealTime();
+#endif
+
+}  // namespace
+
+BENCHMARK_MAIN();
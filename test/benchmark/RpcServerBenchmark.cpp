@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/communication/RpcClient.h>
+#include <up-cpp/communication/RpcServer.h>
+#include <up-cpp/transport/LoopbackTransport.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::communication::RpcClient;
+using uprotocol::communication::RpcServer;
+using uprotocol::transport::LoopbackTransport;
+
+/// @brief Calls to the fast method made behind each slow call
+constexpr int FAST_CALLS = 16;
+
+/// @brief Time the slow method takes to handle a request
+constexpr auto SLOW_HANDLER_TIME = 200us;
+
+v1::UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+	v1::UUri uri;
+	uri.set_authority_name("10.0.0.1");
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+/// @brief Counts outstanding calls and lets the benchmark thread wait for them
+class Completion {
+public:
+	void reset(int64_t expected) {
+		std::lock_guard lock(mutex_);
+		remaining_ = expected;
+	}
+
+	void done() {
+		std::lock_guard lock(mutex_);
+		if (--remaining_ == 0) {
+			finished_.notify_one();
+		}
+	}
+
+	void wait() {
+		std::unique_lock lock(mutex_);
+		finished_.wait(lock, [this]() { return remaining_ == 0; });
+	}
+
+private:
+	std::mutex mutex_;
+	std::condition_variable finished_;
+	int64_t remaining_{0};
+};
+
+/// @brief One slow and FAST_CALLS fast calls are made from one thread per
+///        iteration. The time measured is until every fast call has been
+///        answered. With an argument of 1, both servers dispatch to a
+///        ThreadPool, so the fast calls do not wait behind the slow one.
+void BM_SlowMethodBlocking(benchmark::State& state) {
+	auto transport =
+	    std::make_shared<LoopbackTransport>(makeUri(0x00010001, 0));
+	const auto slow_method = makeUri(0x00010001, 0x0101);
+	const auto fast_method = makeUri(0x00010001, 0x0102);
+
+	utils::ThreadPool pool(4096, 4, 1000ms);
+	std::optional<RpcServer::Dispatch> dispatch;
+	if (state.range(0) != 0) {
+		dispatch.emplace();
+		dispatch->executor = RpcServer::Dispatch::onThreadPool(pool);
+	}
+
+	auto slow_server =
+	    RpcServer::create(
+	        transport, slow_method,
+	        [](const v1::UMessage&) {
+		        std::this_thread::sleep_for(SLOW_HANDLER_TIME);
+		        return std::nullopt;
+	        },
+	        {}, {}, dispatch)
+	        .value();
+	auto fast_server =
+	    RpcServer::create(
+	        transport, fast_method,
+	        [](const v1::UMessage&) { return std::nullopt; }, {}, {},
+	        dispatch)
+	        .value();
+
+	RpcClient slow_client(transport, v1::UUri(slow_method), v1::UPRIORITY_CS4,
+	                      1000ms);
+	RpcClient fast_client(transport, v1::UUri(fast_method), v1::UPRIORITY_CS4,
+	                      1000ms);
+	Completion slow_done;
+	Completion fast_done;
+
+	for (auto _ : state) {
+		slow_done.reset(1);
+		fast_done.reset(FAST_CALLS);
+
+		const auto start = std::chrono::steady_clock::now();
+		slow_client.invokeMethod(
+		    [&slow_done](RpcClient::MessageOrStatus) { slow_done.done(); });
+		for (int call = 0; call < FAST_CALLS; ++call) {
+			fast_client.invokeMethod(
+			    [&fast_done](RpcClient::MessageOrStatus) { fast_done.done(); });
+		}
+		fast_done.wait();
+		state.SetIterationTime(
+		    std::chrono::duration<double>(std::chrono::steady_clock::now() -
+		                                  start)
+		        .count());
+
+		// Not timed: keeps slow calls from piling up between iterations
+		slow_done.wait();
+	}
+	state.SetItemsProcessed(state.iterations() * FAST_CALLS);
+
+	const auto stats = fast_server->dispatchStats();
+	state.counters["fast_queue_p99_us"] =
+	    std::chrono::duration<double, std::micro>(
+	        stats.queue_wait.percentile(0.99))
+	        .count();
+}
+
+BENCHMARK(BM_SlowMethodBlocking)
+    ->ArgName("pool")
+    ->Arg(0)
+    ->Arg(1)
+    ->UseManualTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
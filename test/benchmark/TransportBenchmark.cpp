@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <unistd.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/transport/LoopbackTransport.h>
+#include <up-cpp/transport/SharedMemoryTransport.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace {
+using namespace uprotocol;
+using namespace uprotocol::datamodel::builder;
+using uprotocol::transport::LoopbackTransport;
+using uprotocol::transport::SharedMemoryTransport;
+using uprotocol::transport::UTransport;
+
+v1::UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+	v1::UUri uri;
+	uri.set_authority_name("10.0.0.1");
+	uri.set_ue_id(ue_id);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+v1::UMessage makePublish(size_t payload_size) {
+	return UMessageBuilder::publish(makeUri(0x00010001, 0x8001))
+	    .build(Payload(std::string(payload_size, 'x'),
+	                   v1::UPAYLOAD_FORMAT_RAW));
+}
+
+SharedMemoryTransport::Config shmConfig() {
+	SharedMemoryTransport::Config config;
+	config.name = "/up-cpp-bench-" + std::to_string(getpid());
+	config.slot_count = 4096;
+	config.slot_size = 64 * 1024;
+	return config;
+}
+
+/// @brief Creates a sender and receiver pair. For loopback these are the same
+///        transport instance.
+template <typename TransportT>
+std::pair<std::shared_ptr<UTransport>, std::shared_ptr<UTransport>>
+makeTransports();
+
+template <>
+std::pair<std::shared_ptr<UTransport>, std::shared_ptr<UTransport>>
+makeTransports<LoopbackTransport>() {
+	auto transport = std::make_shared<LoopbackTransport>(makeUri(0x00010001, 0));
+	return {transport, transport};
+}
+
+template <>
+std::pair<std::shared_ptr<UTransport>, std::shared_ptr<UTransport>>
+makeTransports<SharedMemoryTransport>() {
+	auto config = shmConfig();
+	SharedMemoryTransport::remove(config.name);
+	auto sender =
+	    std::make_shared<SharedMemoryTransport>(makeUri(0x00010001, 0), config);
+	auto receiver =
+	    std::make_shared<SharedMemoryTransport>(makeUri(0x00010002, 0), config);
+	SharedMemoryTransport::remove(config.name);
+	return {sender, receiver};
+}
+
+void waitForCount(const std::atomic<uint64_t>& count, uint64_t target) {
+	while (count.load(std::memory_order_acquire) < target) {
+		std::this_thread::yield();
+	}
+}
+
+/// @brief Time from send() until the listener has been called.
+template <typename TransportT>
+void BM_Latency(benchmark::State& state) {
+	auto [sender, receiver] = makeTransports<TransportT>();
+	std::atomic<uint64_t> received{0};
+	auto handle = receiver->registerListener(
+	    makeUri(0x00010001, 0x8001), [&received](const v1::UMessage&) {
+		    received.fetch_add(1, std::memory_order_release);
+	    });
+
+	auto message = makePublish(state.range(0));
+	uint64_t sent = 0;
+	for (auto _ : state) {
+		auto status = sender->send(message);
+		benchmark::DoNotOptimize(status);
+		waitForCount(received, ++sent);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+/// @brief Messages per second, with the receiver draining concurrently.
+template <typename TransportT>
+void BM_Throughput(benchmark::State& state) {
+	auto [sender, receiver] = makeTransports<TransportT>();
+	std::atomic<uint64_t> received{0};
+	auto handle = receiver->registerListener(
+	    makeUri(0x00010001, 0x8001), [&received](const v1::UMessage&) {
+		    received.fetch_add(1, std::memory_order_release);
+	    });
+
+	auto message = makePublish(state.range(0));
+	for (auto _ : state) {
+		auto status = sender->send(message);
+		benchmark::DoNotOptimize(status);
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+	state.counters["received"] = static_cast<double>(received.load());
+}
+
+BENCHMARK_TEMPLATE(BM_Latency, LoopbackTransport)->Range(64, 16 * 1024);
+BENCHMARK_TEMPLATE(BM_Latency, SharedMemoryTransport)->Range(64, 16 * 1024);
+BENCHMARK_TEMPLATE(BM_Throughput, LoopbackTransport)->Range(64, 16 * 1024);
+BENCHMARK_TEMPLATE(BM_Throughput, SharedMemoryTransport)
+    ->Range(64, 16 * 1024);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+
+#include <array>
+
+#include "AllocationCounter.h"
+
+namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::test::AllocationCounter;
+
+UMessageBuilder makeBuilder() {
+	v1::UUri topic;
+	topic.set_authority_name("vehicle.example.com");
+	topic.set_ue_id(0x10010001);
+	topic.set_ue_version_major(1);
+	topic.set_resource_id(0x8001);
+	auto builder = UMessageBuilder::publish(std::move(topic));
+	builder.withTtl(1s).withIdPrefetch(64);
+	return builder;
+}
+
+Payload makePayload() {
+	static const auto shared = std::make_shared<const Payload::Serialized>(
+	    std::string(64, 'x'), v1::UPAYLOAD_FORMAT_RAW);
+	return Payload(shared);
+}
+
+/// @brief A new heap message for every build
+void BM_Build(benchmark::State& state) {
+	auto builder = makeBuilder();
+	AllocationCounter counter(state, "allocs/msg");
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(builder.build(makePayload()));
+	}
+}
+
+/// @brief One message overwritten in place by every build
+void BM_BuildInto(benchmark::State& state) {
+	auto builder = makeBuilder();
+	v1::UMessage message;
+	builder.buildInto(message, makePayload());
+	AllocationCounter counter(state, "allocs/msg");
+
+	for (auto _ : state) {
+		builder.buildInto(message, makePayload());
+		benchmark::DoNotOptimize(message);
+	}
+}
+
+/// @brief Messages built on an arena that is reset after every build
+void BM_BuildOnArena(benchmark::State& state) {
+	auto builder = makeBuilder();
+	static std::array<char, 16384> initial_block;
+	google::protobuf::ArenaOptions options;
+	options.initial_block = initial_block.data();
+	options.initial_block_size = initial_block.size();
+	google::protobuf::Arena arena(options);
+	AllocationCounter counter(state, "allocs/msg");
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(builder.build(arena, makePayload()));
+		arena.Reset();
+	}
+}
+
+BENCHMARK(BM_Build);
+BENCHMARK(BM_BuildInto);
+BENCHMARK(BM_BuildOnArena);
+
+}  // namespace
+
+BENCHMARK_MAIN();
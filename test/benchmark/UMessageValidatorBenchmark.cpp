@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/datamodel/builder/Uuid.h>
+#include <up-cpp/datamodel/validator/UMessage.h>
+
+namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::datamodel::builder::UMessageBuilder;
+namespace MessageValidator = uprotocol::datamodel::validator::message;
+
+v1::UUri makeUri(uint32_t resource_id) {
+	v1::UUri uri;
+	uri.set_authority_name("vehicle.example.com");
+	uri.set_ue_id(0x10010001);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(resource_id);
+	return uri;
+}
+
+v1::UMessage makeMessage(v1::UMessageType type) {
+	switch (type) {
+		case v1::UMESSAGE_TYPE_REQUEST:
+			return UMessageBuilder::request(makeUri(0x1), makeUri(0),
+			                                v1::UPRIORITY_CS4, 10s)
+			    .build();
+		case v1::UMESSAGE_TYPE_RESPONSE:
+			return UMessageBuilder::response(
+			           makeUri(0),
+			           datamodel::builder::UuidBuilder::getBuilder().build(),
+			           v1::UPRIORITY_CS4, makeUri(0x1))
+			    .withTtl(10s)
+			    .build();
+		case v1::UMESSAGE_TYPE_NOTIFICATION:
+			return UMessageBuilder::notification(makeUri(0x8001), makeUri(0))
+			    .withTtl(10s)
+			    .build();
+		default:
+			return UMessageBuilder::publish(makeUri(0x8001))
+			    .withTtl(10s)
+			    .build();
+	}
+}
+
+/// @brief Reference implementation formerly used by isValid(): try every
+///        message type in turn.
+bool cascadeIsValid(const v1::UMessage& message) {
+	return std::get<0>(MessageValidator::isValidRpcRequest(message)) ||
+	       std::get<0>(MessageValidator::isValidRpcResponse(message)) ||
+	       std::get<0>(MessageValidator::isValidPublish(message)) ||
+	       std::get<0>(MessageValidator::isValidNotification(message));
+}
+
+void BM_CascadeIsValid(benchmark::State& state) {
+	auto message = makeMessage(static_cast<v1::UMessageType>(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(cascadeIsValid(message));
+	}
+}
+
+void BM_IsValid(benchmark::State& state) {
+	auto message = makeMessage(static_cast<v1::UMessageType>(state.range(0)));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(MessageValidator::isValid(message));
+	}
+}
+
+void messageTypes(benchmark::internal::Benchmark* benchmark) {
+	benchmark->ArgName("type");
+	for (auto type : {v1::UMESSAGE_TYPE_PUBLISH, v1::UMESSAGE_TYPE_REQUEST,
+	                  v1::UMESSAGE_TYPE_RESPONSE,
+	                  v1::UMESSAGE_TYPE_NOTIFICATION}) {
+		benchmark->Arg(type);
+	}
+}
+
+BENCHMARK(BM_CascadeIsValid)->Apply(messageTypes);
+BENCHMARK(BM_IsValid)->Apply(messageTypes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
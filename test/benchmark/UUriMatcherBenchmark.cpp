@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/transport/LoopbackTransport.h>
+#include <up-cpp/utils/UUriMatcher.h>
+
+#include <random>
+#include <vector>
+
+namespace {
+using namespace uprotocol;
+using uprotocol::utils::UUriMatcher;
+
+constexpr uint32_t NUM_AUTHORITIES = 16;
+constexpr uint32_t NUM_SERVICES = 256;
+constexpr uint32_t NUM_RESOURCES = 64;
+
+v1::UUri makeUri(uint32_t authority, uint32_t service, uint32_t resource) {
+	v1::UUri uri;
+	uri.set_authority_name("host" + std::to_string(authority));
+	uri.set_ue_id(0x00010000 | service);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(0x8000 + resource);
+	return uri;
+}
+
+/// @brief Builds a set of filters where roughly one in ten uses a wildcard in
+///        one of its fields.
+std::vector<v1::UUri> makeFilters(size_t count) {
+	std::mt19937 rng(1234);
+	std::vector<v1::UUri> filters;
+	filters.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		auto filter = makeUri(rng() % NUM_AUTHORITIES, rng() % NUM_SERVICES,
+		                      rng() % NUM_RESOURCES);
+		switch (rng() % 40) {
+			case 0:
+				filter.set_authority_name("*");
+				break;
+			case 1:
+				filter.set_ue_id(filter.ue_id() | 0xFFFF);
+				break;
+			case 2:
+				filter.set_ue_version_major(0xFF);
+				break;
+			case 3:
+				filter.set_resource_id(0xFFFF);
+				break;
+			default:
+				break;
+		}
+		filters.push_back(std::move(filter));
+	}
+	return filters;
+}
+
+std::vector<v1::UUri> makeLookups(size_t count) {
+	std::mt19937 rng(5678);
+	std::vector<v1::UUri> lookups;
+	lookups.reserve(count);
+	for (size_t i = 0; i < count; ++i) {
+		lookups.push_back(makeUri(rng() % NUM_AUTHORITIES,
+		                          rng() % NUM_SERVICES, rng() % NUM_RESOURCES));
+	}
+	return lookups;
+}
+
+/// @brief Straightforward field-by-field comparison, as a linear scan of
+///        registrations would do.
+bool matches(const v1::UUri& filter, const v1::UUri& uri) {
+	return ((filter.authority_name() == "*") ||
+	        (filter.authority_name() == uri.authority_name())) &&
+	       (((filter.ue_id() & 0xFFFF) == 0xFFFF) ||
+	        ((filter.ue_id() & 0xFFFF) == (uri.ue_id() & 0xFFFF))) &&
+	       (((filter.ue_id() & 0xFFFF0000) == 0) ||
+	        ((filter.ue_id() & 0xFFFF0000) == (uri.ue_id() & 0xFFFF0000))) &&
+	       ((filter.ue_version_major() == 0xFF) ||
+	        (filter.ue_version_major() == uri.ue_version_major())) &&
+	       ((filter.resource_id() == 0xFFFF) ||
+	        (filter.resource_id() == uri.resource_id()));
+}
+
+void BM_LinearScan(benchmark::State& state) {
+	auto filters = makeFilters(state.range(0));
+	auto lookups = makeLookups(1024);
+
+	size_t i = 0;
+	size_t matched = 0;
+	for (auto _ : state) {
+		const auto& uri = lookups[i++ % lookups.size()];
+		for (const auto& filter : filters) {
+			if (matches(filter, uri)) {
+				++matched;
+			}
+		}
+		benchmark::DoNotOptimize(matched);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+void BM_UUriMatcher(benchmark::State& state) {
+	UUriMatcher<size_t> matcher;
+	auto filters = makeFilters(state.range(0));
+	for (size_t f = 0; f < filters.size(); ++f) {
+		matcher.insert(filters[f], f);
+	}
+	auto lookups = makeLookups(1024);
+
+	size_t i = 0;
+	size_t matched = 0;
+	for (auto _ : state) {
+		matcher.forEachMatch(lookups[i++ % lookups.size()],
+		                     [&matched](size_t) { ++matched; });
+		benchmark::DoNotOptimize(matched);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+void BM_UUriMatcherInsertErase(benchmark::State& state) {
+	UUriMatcher<size_t> matcher;
+	auto filters = makeFilters(state.range(0));
+	for (size_t f = 0; f < filters.size(); ++f) {
+		matcher.insert(filters[f], f);
+	}
+
+	size_t i = 0;
+	for (auto _ : state) {
+		auto id = matcher.insert(filters[i % filters.size()], i);
+		matcher.erase(id);
+		++i;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+/// @brief End-to-end delivery cost through LoopbackTransport with many
+///        registered listeners.
+void BM_LoopbackDispatch(benchmark::State& state) {
+	v1::UUri def_src = makeUri(0, 1, 0);
+	def_src.set_resource_id(0);
+	transport::LoopbackTransport transport(def_src);
+
+	std::vector<transport::UTransport::ListenHandle> handles;
+	size_t calls = 0;
+	for (const auto& filter : makeFilters(state.range(0))) {
+		auto handle = transport.registerListener(
+		    filter, [&calls](const v1::UMessage&) { ++calls; });
+		handles.push_back(std::move(handle).value());
+	}
+
+	std::vector<v1::UMessage> messages;
+	for (auto& topic : makeLookups(1024)) {
+		messages.push_back(
+		    datamodel::builder::UMessageBuilder::publish(std::move(topic))
+		        .build());
+	}
+
+	size_t i = 0;
+	for (auto _ : state) {
+		auto status = transport.send(messages[i++ % messages.size()]);
+		benchmark::DoNotOptimize(status);
+	}
+	state.SetItemsProcessed(state.iterations());
+	state.counters["listeners_called"] = static_cast<double>(calls);
+}
+
+BENCHMARK(BM_LinearScan)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_UUriMatcher)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_UUriMatcherInsertErase)->RangeMultiplier(10)->Range(1000, 100000);
+BENCHMARK(BM_LoopbackDispatch)->RangeMultiplier(10)->Range(1000, 100000);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/serializer/UUri.h>
+#include <up-cpp/datamodel/validator/UUri.h>
+
+#include <sstream>
+#include <string>
+
+namespace {
+using namespace uprotocol;
+using uprotocol::datamodel::serializer::uri::AsBytes;
+using uprotocol::datamodel::serializer::uri::AsString;
+
+v1::UUri testUri() {
+	v1::UUri uri;
+	uri.set_authority_name("vehicle.example.com");
+	uri.set_ue_id(0x10010001);
+	uri.set_ue_version_major(0xFE);
+	uri.set_resource_id(0x7500);
+	return uri;
+}
+
+/// @brief Reference implementation formerly used by AsString::serialize()
+std::string streamSerialize(const v1::UUri& uri) {
+	using namespace uprotocol::datamodel::validator::uri;
+	auto [valid, reason] = isValid(uri);
+	if (!valid) {
+		throw std::invalid_argument("Invalid UUri For Serialization");
+	}
+	std::stringstream ss;
+	ss << std::hex << std::uppercase;
+	if (!isLocal(uri)) {
+		ss << "//" << uri.authority_name();
+	}
+	ss << "/" << uri.ue_id() << "/" << uri.ue_version_major() << "/"
+	   << uri.resource_id();
+	return std::move(ss).str();
+}
+
+void BM_SerializeStream(benchmark::State& state) {
+	auto uri = testUri();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(streamSerialize(uri));
+	}
+}
+
+void BM_SerializeString(benchmark::State& state) {
+	auto uri = testUri();
+	const auto validation = static_cast<AsString::Validation>(state.range(0));
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(AsString::serialize(uri, validation));
+	}
+}
+
+void BM_SerializeReusedString(benchmark::State& state) {
+	auto uri = testUri();
+	const auto validation = static_cast<AsString::Validation>(state.range(0));
+	std::string out;
+	for (auto _ : state) {
+		AsString::serialize(uri, out, validation);
+		benchmark::DoNotOptimize(out.data());
+	}
+}
+
+void BM_SerializeBuffer(benchmark::State& state) {
+	auto uri = testUri();
+	const auto validation = static_cast<AsString::Validation>(state.range(0));
+	char buffer[AsString::BUFFER_SIZE];
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(AsString::serialize(uri, buffer, validation));
+	}
+}
+
+void BM_SerializeProtobuf(benchmark::State& state) {
+	auto uri = testUri();
+	std::string out;
+	for (auto _ : state) {
+		uri.SerializeToString(&out);
+		benchmark::DoNotOptimize(out.data());
+	}
+}
+
+void BM_DeserializeProtobuf(benchmark::State& state) {
+	const auto serialized = testUri().SerializeAsString();
+	for (auto _ : state) {
+		v1::UUri uri;
+		uri.ParseFromString(serialized);
+		benchmark::DoNotOptimize(uri);
+	}
+}
+
+void BM_SerializeBytes(benchmark::State& state) {
+	auto uri = testUri();
+	uint8_t buffer[AsBytes::MAX_SIZE];
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+		    AsBytes::serialize(uri, buffer, sizeof(buffer)));
+		benchmark::ClobberMemory();
+	}
+}
+
+void BM_DeserializeBytes(benchmark::State& state) {
+	const auto bytes = AsBytes::serialize(testUri());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(
+		    AsBytes::deserialize(bytes.data(), bytes.size()));
+	}
+}
+
+constexpr auto CHECKED = static_cast<int64_t>(AsString::Validation::CHECKED);
+constexpr auto TRUSTED = static_cast<int64_t>(AsString::Validation::TRUSTED);
+
+BENCHMARK(BM_SerializeStream);
+BENCHMARK(BM_SerializeString)->ArgName("trusted")->Arg(CHECKED)->Arg(TRUSTED);
+BENCHMARK(BM_SerializeReusedString)
+    ->ArgName("trusted")
+    ->Arg(CHECKED)
+    ->Arg(TRUSTED);
+BENCHMARK(BM_SerializeBuffer)->ArgName("trusted")->Arg(CHECKED)->Arg(TRUSTED);
+BENCHMARK(BM_SerializeProtobuf);
+BENCHMARK(BM_DeserializeProtobuf);
+BENCHMARK(BM_SerializeBytes);
+BENCHMARK(BM_DeserializeBytes);
+
+}  // namespace
+
+BENCHMARK_MAIN();
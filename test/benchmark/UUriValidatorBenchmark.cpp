@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/validator/UUri.h>
+
+namespace {
+using namespace uprotocol;
+using namespace uprotocol::datamodel::validator::uri;
+
+/// @brief Publish topic URI, the third form isValid() used to try
+v1::UUri testUri() {
+	v1::UUri uri;
+	uri.set_authority_name("vehicle.example.com");
+	uri.set_ue_id(0x10010001);
+	uri.set_ue_version_major(1);
+	uri.set_resource_id(0x8001);
+	return uri;
+}
+
+/// @brief Reference implementation formerly used by isValid()
+bool sequentialIsValid(const v1::UUri& uri) {
+	return std::get<0>(isValidRpcMethod(uri)) ||
+	       std::get<0>(isValidRpcResponse(uri)) ||
+	       std::get<0>(isValidPublishTopic(uri)) ||
+	       std::get<0>(isValidNotification(uri));
+}
+
+void BM_SequentialIsValid(benchmark::State& state) {
+	auto uri = testUri();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(sequentialIsValid(uri));
+	}
+}
+
+void BM_IsValid(benchmark::State& state) {
+	auto uri = testUri();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(isValid(uri));
+	}
+}
+
+void BM_Classify(benchmark::State& state) {
+	auto uri = testUri();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(classify(uri));
+	}
+}
+
+BENCHMARK(BM_SequentialIsValid);
+BENCHMARK(BM_IsValid);
+BENCHMARK(BM_Classify);
+
+}  // namespace
+
+BENCHMARK_MAIN();
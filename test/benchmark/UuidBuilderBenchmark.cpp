@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/datamodel/builder/Uuid.h>
+#include <up-cpp/datamodel/constants/UuidConstants.h>
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <vector>
+
+namespace {
+using namespace uprotocol;
+using namespace uprotocol::datamodel;
+using uprotocol::datamodel::builder::UuidBuilder;
+
+/// @brief Reference builder using the same algorithm as UuidBuilder, with
+///        its shared state guarded by a mutex instead of a CAS.
+class MutexUuidBuilder {
+public:
+	v1::UUID build() {
+		auto unix_ts_ms =
+		    std::chrono::time_point_cast<std::chrono::milliseconds>(
+		        std::chrono::system_clock::now());
+
+		uint64_t msb;
+		{
+			std::lock_guard lock(mutex_);
+			if (unix_ts_ms > last_unix_ts_ms_) {
+				counter_ = 0;
+				last_unix_ts_ms_ = unix_ts_ms;
+			}
+			msb = static_cast<uint64_t>(
+			          last_unix_ts_ms_.time_since_epoch().count())
+			      << UUID_TIMESTAMP_SHIFT;
+			msb |= static_cast<uint64_t>(UUID_VERSION_8) << UUID_VERSION_SHIFT;
+			msb |= (counter_ < UUID_COUNTER_MASK) ? counter_++ : counter_;
+		}
+
+		v1::UUID uuid;
+		uuid.set_msb(msb);
+		uuid.set_lsb(rand_b_ | (static_cast<uint64_t>(UUID_VARIANT_RFC4122)
+		                        << UUID_VARIANT_SHIFT));
+		return uuid;
+	}
+
+private:
+	std::mutex mutex_;
+	uint64_t counter_{0};
+	std::chrono::time_point<std::chrono::system_clock,
+	                        std::chrono::milliseconds>
+	    last_unix_ts_ms_{};
+	const uint64_t rand_b_{std::mt19937_64{std::random_device{}()}() &
+	                       UUID_RANDOM_MASK};
+};
+
+void BM_UuidBuilder(benchmark::State& state) {
+	// Copies share state, as with builders held by UMessageBuilder
+	static const UuidBuilder shared = UuidBuilder::getBuilder();
+	UuidBuilder builder = shared;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(builder.build());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+void BM_MutexUuidBuilder(benchmark::State& state) {
+	static MutexUuidBuilder builder;
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(builder.build());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+/// @brief Per-UUID cost when building in batches
+void BM_UuidBuilderBatch(benchmark::State& state) {
+	auto builder = UuidBuilder::getBuilder();
+	std::vector<v1::UUID> uuids(state.range(0));
+
+	for (auto _ : state) {
+		builder.buildBatch(uuids.data(), uuids.size());
+		benchmark::DoNotOptimize(uuids.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// @brief Message build cost with and without ID prefetching
+void BM_UMessageBuild(benchmark::State& state) {
+	v1::UUri topic;
+	topic.set_authority_name("10.0.0.1");
+	topic.set_ue_id(0x00010001);
+	topic.set_ue_version_major(1);
+	topic.set_resource_id(0x8001);
+	auto builder = datamodel::builder::UMessageBuilder::publish(
+	    std::move(topic));
+	builder.withIdPrefetch(state.range(0));
+
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(builder.build());
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_UuidBuilder)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_MutexUuidBuilder)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(BM_UuidBuilderBatch)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK(BM_UMessageBuild)->Arg(0)->Arg(64)->Arg(1024);
+
+}  // namespace
+
+BENCHMARK_MAIN();
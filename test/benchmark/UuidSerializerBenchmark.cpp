@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include <up-cpp/datamodel/builder/Uuid.h>
+#include <up-cpp/datamodel/serializer/Uuid.h>
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+namespace {
+using namespace uprotocol;
+using uprotocol::datamodel::builder::UuidBuilder;
+using uprotocol::datamodel::serializer::uuid::AsString;
+
+constexpr int HEX_BASE = 16;
+
+/// @brief Reference implementation formerly used by AsString::serialize()
+std::string streamSerialize(const v1::UUID& uuid) {
+	std::stringstream ss;
+	ss << std::hex << std::setfill('0') << std::setw(8) << (uuid.msb() >> 32)
+	   << "-" << std::setw(4) << ((uuid.msb() >> 16) & 0xFFFF) << "-"
+	   << std::setw(4) << (uuid.msb() & 0xFFFF) << "-" << std::setw(4)
+	   << (uuid.lsb() >> 48) << "-" << std::setw(12)
+	   << (uuid.lsb() & 0xFFFFFFFFFFFF);
+	return std::move(ss).str();
+}
+
+/// @brief Reference implementation formerly used by AsString::deserialize()
+v1::UUID stoullDeserialize(const std::string& str) {
+	uint64_t msb = std::stoull(str.substr(0, 8), nullptr, HEX_BASE) << 32;
+	msb |= std::stoull(str.substr(9, 4), nullptr, HEX_BASE) << 16;
+	msb |= std::stoull(str.substr(14, 4), nullptr, HEX_BASE);
+	uint64_t lsb = std::stoull(str.substr(19, 4), nullptr, HEX_BASE) << 48;
+	lsb |= std::stoull(str.substr(24), nullptr, HEX_BASE);
+
+	v1::UUID uuid;
+	uuid.set_msb(msb);
+	uuid.set_lsb(lsb);
+	return uuid;
+}
+
+void BM_SerializeStream(benchmark::State& state) {
+	auto uuid = UuidBuilder::getBuilder().build();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(streamSerialize(uuid));
+	}
+}
+
+void BM_SerializeString(benchmark::State& state) {
+	auto uuid = UuidBuilder::getBuilder().build();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(AsString::serialize(uuid));
+	}
+}
+
+void BM_SerializeBuffer(benchmark::State& state) {
+	auto uuid = UuidBuilder::getBuilder().build();
+	char buffer[AsString::STRING_LENGTH];
+	for (auto _ : state) {
+		AsString::serialize(uuid, buffer);
+		benchmark::DoNotOptimize(buffer);
+	}
+}
+
+void BM_DeserializeStoull(benchmark::State& state) {
+	auto str = AsString::serialize(UuidBuilder::getBuilder().build());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(stoullDeserialize(str));
+	}
+}
+
+void BM_Deserialize(benchmark::State& state) {
+	auto str = AsString::serialize(UuidBuilder::getBuilder().build());
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(AsString::deserialize(str));
+	}
+}
+
+BENCHMARK(BM_SerializeStream);
+BENCHMARK(BM_SerializeString);
+BENCHMARK(BM_SerializeBuffer);
+BENCHMARK(BM_DeserializeStoull);
+BENCHMARK(BM_Deserialize);
+
+}  // namespace
+
+BENCHMARK_MAIN();
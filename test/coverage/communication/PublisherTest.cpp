@@ -15,26 +15,142 @@
 #include "UTransportMock.h"
 
 namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::communication::Publisher;
+using uprotocol::datamodel::builder::Payload;
 
-class TestFixture : public testing::Test {
+class TestPublisher : public testing::Test {
 protected:
 	// Run once per TEST_F.
 	// Used to set up clean environments per test.
-	void SetUp() override {}
+	void SetUp() override {
+		v1::UUri defaultUri;
+		defaultUri.set_authority_name("10.0.0.1");
+		defaultUri.set_ue_id(0x00011101);
+		defaultUri.set_ue_version_major(0xF8);
+		transport_ = std::make_shared<test::UTransportMock>(defaultUri);
+
+		topic_ = defaultUri;
+		topic_.set_resource_id(0x8101);
+	}
 	void TearDown() override {}
 
 	// Run once per execution of the test application.
 	// Used for setup of all tests. Has access to this instance.
-	TestFixture() = default;
-	~TestFixture() = default;
+	TestPublisher() = default;
+	~TestPublisher() = default;
 
 	// Run once per execution of the test application.
 	// Used only for global setup outside of tests.
 	static void SetUpTestSuite() {}
 	static void TearDownTestSuite() {}
+
+	std::shared_ptr<test::UTransportMock> transport_;
+	v1::UUri topic_;
 };
 
-// TODO replace
-TEST_F(TestFixture, SomeTestName) {}
+TEST_F(TestPublisher, PublishSendsMessage) {
+	Publisher publisher(transport_, topic_, v1::UPAYLOAD_FORMAT_TEXT,
+	                    v1::UPRIORITY_CS2, 1000ms);
+
+	auto status = publisher.publish(
+	    Payload(std::string("data"), v1::UPAYLOAD_FORMAT_TEXT));
+	EXPECT_EQ(status.code(), v1::UCode::OK);
+	EXPECT_EQ(transport_->send_count_, 1);
+
+	const auto& attributes = transport_->message_.attributes();
+	EXPECT_EQ(attributes.type(), v1::UMESSAGE_TYPE_PUBLISH);
+	EXPECT_EQ(attributes.source().SerializeAsString(),
+	          topic_.SerializeAsString());
+	EXPECT_FALSE(attributes.has_sink());
+	EXPECT_EQ(attributes.payload_format(), v1::UPAYLOAD_FORMAT_TEXT);
+	EXPECT_EQ(attributes.priority(), v1::UPRIORITY_CS2);
+	EXPECT_EQ(attributes.ttl(), 1000);
+	EXPECT_EQ(transport_->message_.payload(), "data");
+}
+
+TEST_F(TestPublisher, RepeatedPublishUpdatesIdAndPayload) {
+	Publisher publisher(transport_, topic_, v1::UPAYLOAD_FORMAT_TEXT);
+
+	EXPECT_EQ(publisher
+	              .publish(Payload(std::string("first"),
+	                               v1::UPAYLOAD_FORMAT_TEXT))
+	              .code(),
+	          v1::UCode::OK);
+	auto first = transport_->message_;
+
+	EXPECT_EQ(publisher
+	              .publish(Payload(std::string("second"),
+	                               v1::UPAYLOAD_FORMAT_TEXT))
+	              .code(),
+	          v1::UCode::OK);
+	auto second = transport_->message_;
+
+	EXPECT_EQ(transport_->send_count_, 2);
+	EXPECT_EQ(first.payload(), "first");
+	EXPECT_EQ(second.payload(), "second");
+	EXPECT_LT(first.attributes().id().msb(), second.attributes().id().msb());
+	EXPECT_FALSE(second.attributes().has_ttl());
+
+	*second.mutable_attributes()->mutable_id() = first.attributes().id();
+	EXPECT_EQ(first.attributes().SerializeAsString(),
+	          second.attributes().SerializeAsString());
+}
+
+TEST_F(TestPublisher, PublishReturnsTransportStatus) {
+	Publisher publisher(transport_, topic_, v1::UPAYLOAD_FORMAT_TEXT);
+	transport_->send_status_.set_code(v1::UCode::UNAVAILABLE);
+
+	auto status = publisher.publish(
+	    Payload(std::string("data"), v1::UPAYLOAD_FORMAT_TEXT));
+	EXPECT_EQ(status.code(), v1::UCode::UNAVAILABLE);
+}
+
+TEST_F(TestPublisher, PublishMismatchedFormatThrows) {
+	Publisher publisher(transport_, topic_, v1::UPAYLOAD_FORMAT_TEXT);
+
+	EXPECT_THROW(auto _ = publisher.publish(Payload(std::string("data"),
+	                                                v1::UPAYLOAD_FORMAT_RAW)),
+	             datamodel::builder::UMessageBuilder::UnexpectedFormat);
+	EXPECT_EQ(transport_->send_count_, 0);
+}
+
+TEST_F(TestPublisher, PublishBatchSendsAllPayloads) {
+	Publisher publisher(transport_, topic_, v1::UPAYLOAD_FORMAT_TEXT);
+
+	for (size_t batch_size : {3, 1, 2}) {
+		std::vector<Payload> payloads;
+		for (size_t i = 0; i < batch_size; ++i) {
+			payloads.emplace_back(std::to_string(i), v1::UPAYLOAD_FORMAT_TEXT);
+		}
+		auto sent_before = transport_->send_count_;
+
+		auto statuses = publisher.publishBatch(std::move(payloads));
+		ASSERT_EQ(statuses.size(), batch_size);
+		for (const auto& status : statuses) {
+			EXPECT_EQ(status.code(), v1::UCode::OK);
+		}
+		EXPECT_EQ(transport_->send_count_, sent_before + batch_size);
+		EXPECT_EQ(transport_->message_.payload(),
+		          std::to_string(batch_size - 1));
+	}
+}
+
+TEST_F(TestPublisher, PublishBatchMismatchedFormatThrows) {
+	Publisher publisher(transport_, topic_, v1::UPAYLOAD_FORMAT_TEXT);
+
+	std::vector<Payload> payloads;
+	payloads.emplace_back(std::string("good"), v1::UPAYLOAD_FORMAT_TEXT);
+	payloads.emplace_back(std::string("bad"), v1::UPAYLOAD_FORMAT_RAW);
+	EXPECT_THROW(auto _ = publisher.publishBatch(std::move(payloads)),
+	             datamodel::builder::UMessageBuilder::UnexpectedFormat);
+	EXPECT_EQ(transport_->send_count_, 0);
+}
+
+TEST_F(TestPublisher, NullTransportThrows) {
+	EXPECT_THROW(Publisher(nullptr, topic_, v1::UPAYLOAD_FORMAT_TEXT),
+	             std::invalid_argument);
+}
 
 }  // namespace
@@ -12,29 +12,512 @@
 #include <gtest/gtest.h>
 #include <up-cpp/communication/RpcClient.h>
 
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include "UTransportMock.h"
 
 namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::communication::RpcClient;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::datamodel::builder::UMessageBuilder;
+
+#ifdef UP_CPP_ENABLE_COROUTINES
+/// @brief Eagerly started coroutine that nobody waits on
+struct Detached {
+	struct promise_type {
+		Detached get_return_object() { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+};
+#endif
 
-class TestFixture : public testing::Test {
+class TestRpcClient : public testing::Test {
 protected:
 	// Run once per TEST_F.
 	// Used to set up clean environments per test.
-	void SetUp() override {}
+	void SetUp() override {
+		v1::UUri defaultUri;
+		defaultUri.set_authority_name("10.0.0.1");
+		defaultUri.set_ue_id(0x00011101);
+		defaultUri.set_ue_version_major(0xF8);
+		transport_ = std::make_shared<test::UTransportMock>(defaultUri);
+
+		method_.set_authority_name("10.0.0.2");
+		method_.set_ue_id(0x00010002);
+		method_.set_ue_version_major(0x01);
+		method_.set_resource_id(0x0101);
+	}
 	void TearDown() override {}
 
 	// Run once per execution of the test application.
 	// Used for setup of all tests. Has access to this instance.
-	TestFixture() = default;
-	~TestFixture() = default;
+	TestRpcClient() = default;
+	~TestRpcClient() = default;
 
 	// Run once per execution of the test application.
 	// Used only for global setup outside of tests.
 	static void SetUpTestSuite() {}
 	static void TearDownTestSuite() {}
+
+	RpcClient makeClient(std::chrono::milliseconds ttl = 1000ms) {
+		return RpcClient(transport_, v1::UUri(method_), v1::UPRIORITY_CS4,
+		                 ttl);
+	}
+
+	/// @brief Responds to the last request sent through the transport
+	void respond(std::optional<v1::UCode> commstatus = {}) {
+		auto builder = UMessageBuilder::response(transport_->message_);
+		if (commstatus) {
+			builder.withCommStatus(*commstatus);
+		}
+		transport_->mockMessage(builder.build());
+	}
+
+	std::shared_ptr<test::UTransportMock> transport_;
+	v1::UUri method_;
 };
 
-// TODO replace
-TEST_F(TestFixture, SomeTestName) {}
+TEST_F(TestRpcClient, ConstructRegistersResponseListener) {
+	auto client = makeClient();
+
+	EXPECT_TRUE(transport_->listener_);
+	EXPECT_EQ(transport_->sink_filter_.ue_id(), 0x00011101);
+	EXPECT_EQ(transport_->sink_filter_.resource_id(), 0);
+	EXPECT_FALSE(transport_->source_filter_);
+}
+
+TEST_F(TestRpcClient, ClientsShareResponseListener) {
+	std::optional<RpcClient::MessageOrStatus> first_result;
+	std::optional<RpcClient::MessageOrStatus> second_result;
+	auto first = std::make_unique<RpcClient>(transport_, v1::UUri(method_),
+	                                         v1::UPRIORITY_CS4, 1000ms);
+	const auto shared_listener = transport_->listener_;
+
+	// Registering again would replace the mock's listener
+	transport_->listener_.reset();
+	method_.set_resource_id(0x0102);
+	auto second = std::make_unique<RpcClient>(transport_, v1::UUri(method_),
+	                                          v1::UPRIORITY_CS4, 1000ms);
+	EXPECT_FALSE(transport_->listener_);
+	transport_->listener_ = shared_listener;
+
+	first->invokeMethod(
+	    [&first_result](auto result) { first_result.emplace(std::move(result)); });
+	auto first_request = transport_->message_;
+	second->invokeMethod(
+	    [&second_result](auto result) { second_result.emplace(std::move(result)); });
+
+	respond();
+	EXPECT_FALSE(first_result);
+	ASSERT_TRUE(second_result);
+	EXPECT_EQ(second_result->value().attributes().source().resource_id(),
+	          0x0102);
+
+	transport_->message_ = first_request;
+	respond();
+	ASSERT_TRUE(first_result);
+	EXPECT_EQ(first_result->value().attributes().source().resource_id(),
+	          0x0101);
+
+	// Unregistered only once the last client is gone
+	first.reset();
+	EXPECT_FALSE(transport_->cleanup_listener_);
+	second.reset();
+	EXPECT_TRUE(transport_->cleanup_listener_);
+}
+
+TEST_F(TestRpcClient, NonResponsesIgnored) {
+	std::optional<RpcClient::MessageOrStatus> result;
+	auto client = makeClient();
+	client.invokeMethod([&result](auto r) { result.emplace(std::move(r)); });
+
+	// A notification that reuses the request ID must not complete it
+	v1::UUri source = method_;
+	source.set_resource_id(0x8001);
+	auto notification =
+	    UMessageBuilder::notification(std::move(source),
+	                                  v1::UUri(transport_->getDefaultSource()))
+	        .build();
+	*notification.mutable_attributes()->mutable_reqid() =
+	    transport_->message_.attributes().id();
+	transport_->mockMessage(notification);
+	EXPECT_FALSE(result);
+
+	respond();
+	EXPECT_TRUE(result);
+}
+
+TEST_F(TestRpcClient, NullTransportThrows) {
+	EXPECT_THROW(RpcClient(nullptr, v1::UUri(method_), v1::UPRIORITY_CS4,
+	                       1000ms),
+	             std::invalid_argument);
+}
+
+TEST_F(TestRpcClient, InvokeSendsRequest) {
+	auto client = makeClient(500ms);
+	auto future = client.invokeMethod();
+
+	EXPECT_EQ(transport_->send_count_, 1);
+	const auto& attr = transport_->message_.attributes();
+	EXPECT_EQ(attr.type(), v1::UMESSAGE_TYPE_REQUEST);
+	EXPECT_EQ(attr.sink().resource_id(), 0x0101);
+	EXPECT_EQ(attr.source().resource_id(), 0);
+	EXPECT_EQ(attr.priority(), v1::UPRIORITY_CS4);
+	EXPECT_EQ(attr.ttl(), 500);
+}
+
+TEST_F(TestRpcClient, ResponseCompletesRequest) {
+	auto client = makeClient();
+	auto future = client.invokeMethod();
+	const auto reqid = transport_->message_.attributes().id();
+
+	respond();
+	ASSERT_EQ(future.wait_for(0s), std::future_status::ready);
+	auto result = future.get();
+	ASSERT_TRUE(result);
+	EXPECT_EQ(result.value().attributes().reqid().msb(), reqid.msb());
+	EXPECT_EQ(result.value().attributes().reqid().lsb(), reqid.lsb());
+}
+
+TEST_F(TestRpcClient, ResponsesMatchedByRequestId) {
+	auto client = makeClient();
+	std::vector<v1::UMessage> requests;
+	std::vector<int> completed;
+	for (int i = 0; i < 3; ++i) {
+		client.invokeMethod(
+		    Payload(std::string("x"), v1::UPAYLOAD_FORMAT_TEXT),
+		    [&completed, i](RpcClient::MessageOrStatus result) {
+			    EXPECT_TRUE(result);
+			    completed.push_back(i);
+		    });
+		requests.push_back(transport_->message_);
+	}
+
+	for (int i : {2, 0, 1}) {
+		transport_->message_ = requests[i];
+		respond();
+	}
+	EXPECT_EQ(completed, std::vector<int>({2, 0, 1}));
+
+	// Duplicate responses are ignored
+	respond();
+	EXPECT_EQ(completed.size(), 3);
+}
+
+TEST_F(TestRpcClient, CommstatusDeliveredAsError) {
+	auto client = makeClient();
+	auto future = client.invokeMethod();
+
+	respond(v1::UCode::PERMISSION_DENIED);
+	auto result = future.get();
+	ASSERT_FALSE(result);
+	ASSERT_TRUE(std::holds_alternative<RpcClient::Commstatus>(result.error()));
+	EXPECT_EQ(std::get<RpcClient::Commstatus>(result.error()),
+	          v1::UCode::PERMISSION_DENIED);
+}
+
+TEST_F(TestRpcClient, SendFailureDeliveredAsStatus) {
+	auto client = makeClient();
+	transport_->send_status_.set_code(v1::UCode::UNAVAILABLE);
+
+	auto future = client.invokeMethod();
+	ASSERT_EQ(future.wait_for(0s), std::future_status::ready);
+	auto result = future.get();
+	ASSERT_FALSE(result);
+	ASSERT_TRUE(std::holds_alternative<v1::UStatus>(result.error()));
+	EXPECT_EQ(std::get<v1::UStatus>(result.error()).code(),
+	          v1::UCode::UNAVAILABLE);
+
+	// A late response to the failed request is ignored
+	transport_->send_status_.set_code(v1::UCode::OK);
+	respond();
+}
+
+TEST_F(TestRpcClient, UnansweredRequestExpires) {
+	auto client = makeClient(20ms);
+	auto start = std::chrono::steady_clock::now();
+	auto future = client.invokeMethod();
+
+	ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+	auto result = future.get();
+	ASSERT_FALSE(result);
+	ASSERT_TRUE(std::holds_alternative<RpcClient::Commstatus>(result.error()));
+	EXPECT_EQ(std::get<RpcClient::Commstatus>(result.error()),
+	          v1::UCode::DEADLINE_EXCEEDED);
+
+	// A late response is ignored
+	respond();
+}
+
+TEST_F(TestRpcClient, ManyRequestsExpire) {
+	auto client = makeClient(200ms);
+	std::vector<std::future<RpcClient::MessageOrStatus>> futures;
+	for (int i = 0; i < 2000; ++i) {
+		futures.push_back(client.invokeMethod());
+	}
+
+	for (auto& future : futures) {
+		ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+		auto result = future.get();
+		ASSERT_FALSE(result);
+		EXPECT_EQ(std::get<RpcClient::Commstatus>(result.error()),
+		          v1::UCode::DEADLINE_EXCEEDED);
+	}
+}
+
+TEST_F(TestRpcClient, DestructionCancelsPending) {
+	std::future<RpcClient::MessageOrStatus> future;
+	{
+		auto client = makeClient();
+		future = client.invokeMethod();
+	}
+
+	ASSERT_EQ(future.wait_for(0s), std::future_status::ready);
+	auto result = future.get();
+	ASSERT_FALSE(result);
+	ASSERT_TRUE(std::holds_alternative<v1::UStatus>(result.error()));
+	EXPECT_EQ(std::get<v1::UStatus>(result.error()).code(),
+	          v1::UCode::CANCELLED);
+}
+
+/// @brief Transport that checks its response listener is disconnected
+///        before it is destroyed
+class ListenerCheckingTransport : public test::UTransportMock {
+public:
+	ListenerCheckingTransport(const v1::UUri& uri,
+	                          std::shared_ptr<std::atomic<int>> destroyed)
+	    : UTransportMock(uri), destroyed_(std::move(destroyed)) {}
+
+	~ListenerCheckingTransport() override {
+		EXPECT_TRUE(disconnected_);
+		++*destroyed_;
+	}
+
+private:
+	void cleanupListener(CallableConn) override { disconnected_ = true; }
+
+	std::atomic<bool> disconnected_{false};
+	std::shared_ptr<std::atomic<int>> destroyed_;
+};
+
+TEST_F(TestRpcClient, DestroyedWhileExpiring) {
+	constexpr int ITERATIONS = 20;
+	constexpr int REQUESTS = 200;
+	auto destroyed = std::make_shared<std::atomic<int>>(0);
+
+	for (int i = 0; i < ITERATIONS; ++i) {
+		auto transport = std::make_shared<ListenerCheckingTransport>(
+		    transport_->getDefaultSource(), destroyed);
+		transport->send_status_.set_code(v1::UCode::OK);
+		auto client = std::make_unique<RpcClient>(
+		    transport, v1::UUri(method_), v1::UPRIORITY_CS4, 10ms);
+
+		// Shared, since callbacks can still be running on the timer thread
+		// when this iteration ends
+		struct FirstExpiry {
+			std::promise<void> promise;
+			std::atomic<bool> signalled{false};
+		};
+		auto first_expiry = std::make_shared<FirstExpiry>();
+		auto first_expired = first_expiry->promise.get_future();
+		for (int r = 0; r < REQUESTS; ++r) {
+			client->invokeMethod([first_expiry](RpcClient::MessageOrStatus) {
+				if (!first_expiry->signalled.exchange(true)) {
+					first_expiry->promise.set_value();
+				}
+			});
+		}
+
+		// The rest of the batch is still expiring on the timer thread, which
+		// briefly holds the response router each time
+		ASSERT_EQ(first_expired.wait_for(2s), std::future_status::ready);
+		client.reset();
+		transport.reset();
+	}
+
+	// The last router reference may be dropped on the timer thread
+	for (int wait = 0; (*destroyed < ITERATIONS) && (wait < 200); ++wait) {
+		std::this_thread::sleep_for(10ms);
+	}
+	EXPECT_EQ(*destroyed, ITERATIONS);
+}
+
+TEST_F(TestRpcClient, PayloadFormatEnforced) {
+	RpcClient client(transport_, v1::UUri(method_), v1::UPRIORITY_CS4, 1000ms,
+	                 v1::UPAYLOAD_FORMAT_TEXT);
+
+	EXPECT_THROW(
+	    client.invokeMethod(Payload(std::string("x"), v1::UPAYLOAD_FORMAT_RAW),
+	                        [](auto) {}),
+	    UMessageBuilder::UnexpectedFormat);
+	EXPECT_EQ(transport_->send_count_, 0);
+
+	auto future =
+	    client.invokeMethod(Payload(std::string("x"), v1::UPAYLOAD_FORMAT_TEXT));
+	EXPECT_EQ(transport_->message_.attributes().payload_format(),
+	          v1::UPAYLOAD_FORMAT_TEXT);
+}
+
+TEST_F(TestRpcClient, PooledFutureResolvesOnResponse) {
+	auto client = makeClient();
+	auto future = client.invokeMethodPooled();
+	EXPECT_FALSE(future.isReady());
+
+	respond();
+	ASSERT_TRUE(future.isReady());
+	EXPECT_TRUE(future.get());
+}
+
+TEST_F(TestRpcClient, PooledFutureThen) {
+	auto client = makeClient();
+	std::optional<v1::UCode> code;
+	client
+	    .invokeMethodPooled(Payload(std::string("x"), v1::UPAYLOAD_FORMAT_TEXT))
+	    .then([&code](RpcClient::MessageOrStatus result) {
+		    code = std::get<RpcClient::Commstatus>(result.error());
+	    });
+	EXPECT_FALSE(code);
+
+	respond(v1::UCode::NOT_FOUND);
+	EXPECT_EQ(code, v1::UCode::NOT_FOUND);
+}
+
+TEST_F(TestRpcClient, PooledFutureSendFailure) {
+	auto client = makeClient();
+	transport_->send_status_.set_code(v1::UCode::UNAVAILABLE);
+
+	auto result = client.invokeMethodPooled().get();
+	ASSERT_FALSE(result);
+	EXPECT_EQ(std::get<v1::UStatus>(result.error()).code(),
+	          v1::UCode::UNAVAILABLE);
+}
+
+#ifdef UP_CPP_ENABLE_COROUTINES
+TEST_F(TestRpcClient, CoroutineResumedByResponse) {
+	auto client = makeClient();
+	std::optional<RpcClient::MessageOrStatus> result;
+	std::thread::id resumed_on;
+
+	[&]() -> Detached {
+		auto r = co_await client.invokeMethodAsync();
+		resumed_on = std::this_thread::get_id();
+		result.emplace(std::move(r));
+	}();
+	EXPECT_EQ(transport_->send_count_, 1);
+	EXPECT_FALSE(result);
+
+	respond();
+	ASSERT_TRUE(result);
+	EXPECT_TRUE(*result);
+	// The mock transport delivers responses on the calling thread
+	EXPECT_EQ(resumed_on, std::this_thread::get_id());
+}
+
+TEST_F(TestRpcClient, CoroutineSendFailureDoesNotSuspend) {
+	auto client = makeClient();
+	transport_->send_status_.set_code(v1::UCode::UNAVAILABLE);
+	std::optional<RpcClient::MessageOrStatus> result;
+
+	[&]() -> Detached {
+		result.emplace(co_await client.invokeMethodAsync(
+		    Payload(std::string("x"), v1::UPAYLOAD_FORMAT_TEXT)));
+	}();
+	ASSERT_TRUE(result);
+	ASSERT_FALSE(*result);
+	EXPECT_EQ(std::get<v1::UStatus>(result->error()).code(),
+	          v1::UCode::UNAVAILABLE);
+}
+
+TEST_F(TestRpcClient, CoroutineThrowsOnBadPayload) {
+	RpcClient client(transport_, v1::UUri(method_), v1::UPRIORITY_CS4, 1000ms,
+	                 v1::UPAYLOAD_FORMAT_TEXT);
+	bool threw = false;
+
+	[&]() -> Detached {
+		try {
+			co_await client.invokeMethodAsync(
+			    Payload(std::string("x"), v1::UPAYLOAD_FORMAT_RAW));
+		} catch (const UMessageBuilder::UnexpectedFormat&) {
+			threw = true;
+		}
+	}();
+	EXPECT_TRUE(threw);
+	EXPECT_EQ(transport_->send_count_, 0);
+}
+
+TEST_F(TestRpcClient, CoroutineResumedOnExecutor) {
+	auto client = makeClient();
+	utils::ThreadPool pool(16, 1, 1000ms);
+	std::promise<std::thread::id> resumed_on;
+
+	[&]() -> Detached {
+		auto result = co_await client.invokeMethodAsync(&pool);
+		EXPECT_TRUE(result);
+		resumed_on.set_value(std::this_thread::get_id());
+	}();
+
+	respond();
+	auto future = resumed_on.get_future();
+	ASSERT_EQ(future.wait_for(1s), std::future_status::ready);
+	EXPECT_NE(future.get(), std::this_thread::get_id());
+}
+
+// A resume task evicted from a full pool still resumes the coroutine
+TEST_F(TestRpcClient, CoroutineResumedWhenExecutorDiscards) {
+	auto client = makeClient();
+	utils::ThreadPool pool(1, 1, 1000ms);
+	std::promise<void> started;
+	std::promise<void> release;
+	auto blocker = pool.submit([&started, released = release.get_future()]() {
+		started.set_value();
+		released.wait();
+	});
+	started.get_future().wait();
+
+	std::optional<std::thread::id> resumed_on;
+	[&]() -> Detached {
+		auto result = co_await client.invokeMethodAsync(&pool);
+		EXPECT_TRUE(result);
+		resumed_on = std::this_thread::get_id();
+	}();
+
+	respond();
+	EXPECT_FALSE(resumed_on);
+	// Evicts the queued resume task
+	static_cast<void>(pool.submit([]() {}));
+	auto evicted_resumed_on = resumed_on;
+
+	release.set_value();
+	blocker.wait();
+	ASSERT_TRUE(evicted_resumed_on);
+	EXPECT_EQ(*evicted_resumed_on, std::this_thread::get_id());
+}
+
+TEST_F(TestRpcClient, CoroutineTimesOut) {
+	auto client = makeClient(20ms);
+	std::promise<RpcClient::MessageOrStatus> result;
+
+	[&]() -> Detached {
+		result.set_value(co_await client.invokeMethodAsync());
+	}();
+
+	auto future = result.get_future();
+	ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	auto r = future.get();
+	ASSERT_FALSE(r);
+	EXPECT_EQ(std::get<RpcClient::Commstatus>(r.error()),
+	          v1::UCode::DEADLINE_EXCEEDED);
+}
+#endif
 
 }  // namespace
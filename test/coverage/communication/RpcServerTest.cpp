@@ -11,30 +11,366 @@
 
 #include <gtest/gtest.h>
 #include <up-cpp/communication/RpcServer.h>
+#include <up-cpp/datamodel/validator/UUri.h>
+
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "UTransportMock.h"
 
 namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::communication::RpcServer;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::datamodel::builder::UMessageBuilder;
 
-class TestFixture : public testing::Test {
+class TestRpcServer : public testing::Test {
 protected:
 	// Run once per TEST_F.
 	// Used to set up clean environments per test.
-	void SetUp() override {}
+	void SetUp() override {
+		v1::UUri defaultUri;
+		defaultUri.set_authority_name("10.0.0.2");
+		defaultUri.set_ue_id(0x00010002);
+		defaultUri.set_ue_version_major(0x01);
+		transport_ = std::make_shared<test::UTransportMock>(defaultUri);
+
+		method_ = defaultUri;
+		method_.set_resource_id(0x0101);
+
+		client_.set_authority_name("10.0.0.1");
+		client_.set_ue_id(0x00011101);
+		client_.set_ue_version_major(0xF8);
+	}
 	void TearDown() override {}
 
 	// Run once per execution of the test application.
 	// Used for setup of all tests. Has access to this instance.
-	TestFixture() = default;
-	~TestFixture() = default;
+	TestRpcServer() = default;
+	~TestRpcServer() = default;
 
 	// Run once per execution of the test application.
 	// Used only for global setup outside of tests.
 	static void SetUpTestSuite() {}
 	static void TearDownTestSuite() {}
+
+	v1::UMessage makeRequest(std::chrono::milliseconds ttl = 1000ms) {
+		return UMessageBuilder::request(v1::UUri(method_), v1::UUri(client_),
+		                                v1::UPRIORITY_CS4, ttl)
+		    .build();
+	}
+
+	/// @brief Executor that holds tasks until the test runs them
+	RpcServer::Dispatch manualDispatch(size_t max_in_flight = 0) {
+		RpcServer::Dispatch dispatch;
+		dispatch.executor = [this](std::function<void()>&& task) {
+			tasks_.push_back(std::move(task));
+		};
+		dispatch.max_in_flight = max_in_flight;
+		return dispatch;
+	}
+
+	void runTasks() {
+		auto tasks = std::move(tasks_);
+		tasks_.clear();
+		for (auto& task : tasks) {
+			task();
+		}
+	}
+
+	std::shared_ptr<test::UTransportMock> transport_;
+	v1::UUri method_;
+	v1::UUri client_;
+	std::vector<std::function<void()>> tasks_;
 };
 
-// TODO replace
-TEST_F(TestFixture, SomeTestName) {}
+TEST_F(TestRpcServer, CreateRegistersListener) {
+	auto server_or_status = RpcServer::create(
+	    transport_, method_, [](const v1::UMessage&) { return std::nullopt; });
+
+	ASSERT_TRUE(server_or_status);
+	EXPECT_TRUE(transport_->listener_);
+	EXPECT_EQ(transport_->sink_filter_.resource_id(), 0x0101);
+	EXPECT_FALSE(transport_->source_filter_);
+
+	auto server = std::move(server_or_status).value();
+	server.reset();
+	EXPECT_TRUE(transport_->cleanup_listener_);
+}
+
+TEST_F(TestRpcServer, CreateRejectsBadArguments) {
+	auto callback = [](const v1::UMessage&) { return std::nullopt; };
+	EXPECT_THROW(static_cast<void>(
+	                 RpcServer::create(nullptr, method_, std::move(callback))),
+	             std::invalid_argument);
+
+	method_.set_resource_id(0);
+	EXPECT_THROW(static_cast<void>(RpcServer::create(transport_, method_,
+	                                                 std::move(callback))),
+	             datamodel::validator::uri::InvalidUUri);
+}
+
+TEST_F(TestRpcServer, RespondsWithPayload) {
+	auto server = RpcServer::create(
+	                  transport_, method_,
+	                  [](const v1::UMessage&) {
+		                  return Payload(std::string("pong"),
+		                                 v1::UPAYLOAD_FORMAT_TEXT);
+	                  },
+	                  v1::UPAYLOAD_FORMAT_TEXT, 500ms)
+	                  .value();
+
+	const auto request = makeRequest();
+	transport_->mockMessage(request);
+
+	ASSERT_EQ(transport_->send_count_, 1);
+	const auto& response = transport_->message_;
+	EXPECT_EQ(response.attributes().type(), v1::UMESSAGE_TYPE_RESPONSE);
+	EXPECT_EQ(response.attributes().reqid().lsb(),
+	          request.attributes().id().lsb());
+	EXPECT_EQ(response.attributes().ttl(), 500);
+	EXPECT_EQ(response.payload(), "pong");
+
+	const auto stats = server->dispatchStats();
+	EXPECT_EQ(stats.handled, 1);
+	EXPECT_EQ(stats.in_flight, 0);
+	EXPECT_EQ(stats.handler_time.count, 1);
+	// Inline calls do not queue
+	EXPECT_EQ(stats.queue_wait.count, 0);
+}
+
+TEST_F(TestRpcServer, IgnoresInvalidRequests) {
+	size_t calls = 0;
+	auto server = RpcServer::create(transport_, method_,
+	                                [&calls](const v1::UMessage&) {
+		                                ++calls;
+		                                return std::nullopt;
+	                                })
+	                  .value();
+
+	auto publish = UMessageBuilder::publish(v1::UUri(method_)).build();
+	transport_->mockMessage(publish);
+
+	auto expired = makeRequest(1ms);
+	std::this_thread::sleep_for(5ms);
+	transport_->mockMessage(expired);
+
+	EXPECT_EQ(calls, 0);
+	EXPECT_EQ(transport_->send_count_, 0);
+	EXPECT_EQ(server->dispatchStats().expired, 1);
+}
+
+TEST_F(TestRpcServer, CallbackFailureRespondsInternal) {
+	bool fail_with_exception = true;
+	auto server = RpcServer::create(
+	                  transport_, method_,
+	                  [&fail_with_exception](
+	                      const v1::UMessage&) -> std::optional<Payload> {
+		                  if (fail_with_exception) {
+			                  throw std::runtime_error("failed");
+		                  }
+		                  // Wrong format
+		                  return Payload(std::string("{}"),
+		                                 v1::UPAYLOAD_FORMAT_JSON);
+	                  },
+	                  v1::UPAYLOAD_FORMAT_TEXT)
+	                  .value();
+
+	transport_->mockMessage(makeRequest());
+	ASSERT_EQ(transport_->send_count_, 1);
+	EXPECT_EQ(transport_->message_.attributes().commstatus(),
+	          v1::UCode::INTERNAL);
+
+	fail_with_exception = false;
+	transport_->mockMessage(makeRequest());
+	ASSERT_EQ(transport_->send_count_, 2);
+	EXPECT_EQ(transport_->message_.attributes().commstatus(),
+	          v1::UCode::INTERNAL);
+}
+
+TEST_F(TestRpcServer, ExecutorDefersCallback) {
+	std::optional<v1::UMessage> seen;
+	auto server = RpcServer::create(
+	                  transport_, method_,
+	                  [&seen](const v1::UMessage& request) {
+		                  seen = request;
+		                  return std::nullopt;
+	                  },
+	                  {}, {}, manualDispatch())
+	                  .value();
+
+	const auto request = makeRequest();
+	transport_->mockMessage(request);
+	EXPECT_FALSE(seen);
+	EXPECT_EQ(transport_->send_count_, 0);
+	EXPECT_EQ(server->dispatchStats().in_flight, 1);
+
+	runTasks();
+	ASSERT_TRUE(seen);
+	EXPECT_EQ(seen->attributes().id().lsb(), request.attributes().id().lsb());
+	EXPECT_EQ(transport_->send_count_, 1);
+
+	const auto stats = server->dispatchStats();
+	EXPECT_EQ(stats.handled, 1);
+	EXPECT_EQ(stats.in_flight, 0);
+	EXPECT_EQ(stats.queue_wait.count, 1);
+	EXPECT_EQ(stats.handler_time.count, 1);
+}
+
+TEST_F(TestRpcServer, MaxInFlightRejects) {
+	auto server =
+	    RpcServer::create(
+	        transport_, method_,
+	        [](const v1::UMessage&) { return std::nullopt; }, {}, {},
+	        manualDispatch(2))
+	        .value();
+
+	transport_->mockMessage(makeRequest());
+	transport_->mockMessage(makeRequest());
+	EXPECT_EQ(transport_->send_count_, 0);
+
+	const auto rejected = makeRequest();
+	transport_->mockMessage(rejected);
+	ASSERT_EQ(transport_->send_count_, 1);
+	EXPECT_EQ(transport_->message_.attributes().commstatus(),
+	          v1::UCode::RESOURCE_EXHAUSTED);
+	EXPECT_EQ(transport_->message_.attributes().reqid().lsb(),
+	          rejected.attributes().id().lsb());
+	EXPECT_EQ(tasks_.size(), 2);
+
+	// Slots are freed as requests complete
+	runTasks();
+	transport_->mockMessage(makeRequest());
+	EXPECT_EQ(tasks_.size(), 1);
+
+	const auto stats = server->dispatchStats();
+	EXPECT_EQ(stats.handled, 2);
+	EXPECT_EQ(stats.rejected, 1);
+	EXPECT_EQ(stats.in_flight, 1);
+}
+
+TEST_F(TestRpcServer, ExpiredWhileQueued) {
+	size_t calls = 0;
+	auto server = RpcServer::create(
+	                  transport_, method_,
+	                  [&calls](const v1::UMessage&) {
+		                  ++calls;
+		                  return std::nullopt;
+	                  },
+	                  {}, {}, manualDispatch())
+	                  .value();
+
+	transport_->mockMessage(makeRequest(10ms));
+	std::this_thread::sleep_for(20ms);
+	runTasks();
+
+	EXPECT_EQ(calls, 0);
+	EXPECT_EQ(transport_->send_count_, 0);
+	const auto stats = server->dispatchStats();
+	EXPECT_EQ(stats.expired, 1);
+	EXPECT_EQ(stats.in_flight, 0);
+	EXPECT_GE(stats.queue_wait.max, 20ms);
+}
+
+TEST_F(TestRpcServer, DiscardedTaskReleasesSlot) {
+	auto server =
+	    RpcServer::create(
+	        transport_, method_,
+	        [](const v1::UMessage&) { return std::nullopt; }, {}, {},
+	        manualDispatch(1))
+	        .value();
+
+	transport_->mockMessage(makeRequest());
+	EXPECT_EQ(server->dispatchStats().in_flight, 1);
+
+	tasks_.clear();
+	const auto stats = server->dispatchStats();
+	EXPECT_EQ(stats.discarded, 1);
+	EXPECT_EQ(stats.in_flight, 0);
+
+	transport_->mockMessage(makeRequest());
+	EXPECT_EQ(tasks_.size(), 1);
+	EXPECT_EQ(server->dispatchStats().rejected, 0);
+}
+
+TEST_F(TestRpcServer, DestroyDropsQueuedRequests) {
+	size_t calls = 0;
+	auto server = RpcServer::create(
+	                  transport_, method_,
+	                  [&calls](const v1::UMessage&) {
+		                  ++calls;
+		                  return std::nullopt;
+	                  },
+	                  {}, {}, manualDispatch())
+	                  .value();
+
+	transport_->mockMessage(makeRequest());
+	server.reset();
+	runTasks();
+
+	EXPECT_EQ(calls, 0);
+	EXPECT_EQ(transport_->send_count_, 0);
+}
+
+// A response that expires while the callback runs is rejected by the
+// transport. The server must still free the slot and be able to stop.
+TEST_F(TestRpcServer, ResponseSendFailureReleasesSlot) {
+	auto slow = [](const v1::UMessage&) {
+		std::this_thread::sleep_for(30ms);
+		return std::nullopt;
+	};
+
+	for (bool use_executor : {false, true}) {
+		auto server_or_status = RpcServer::create(
+		    transport_, method_, slow, {}, 10ms,
+		    use_executor ? std::optional(manualDispatch(1)) : std::nullopt);
+		ASSERT_TRUE(server_or_status);
+		auto server = std::move(server_or_status).value();
+
+		EXPECT_NO_THROW(transport_->mockMessage(makeRequest()));
+		runTasks();
+		EXPECT_EQ(transport_->send_count_, 0);
+
+		const auto stats = server->dispatchStats();
+		EXPECT_EQ(stats.handled, 1) << "executor " << use_executor;
+		EXPECT_EQ(stats.send_failed, 1) << "executor " << use_executor;
+		EXPECT_EQ(stats.in_flight, 0) << "executor " << use_executor;
+
+		// Returns rather than waiting on a call that never finished
+		auto stopped = std::async(std::launch::async,
+		                          [&server]() { server.reset(); });
+		ASSERT_EQ(stopped.wait_for(2s), std::future_status::ready);
+	}
+}
+
+TEST_F(TestRpcServer, DispatchOnThreadPool) {
+	utils::ThreadPool pool(16, 1, 1000ms);
+	std::promise<std::thread::id> ran_on;
+	RpcServer::Dispatch dispatch;
+	dispatch.executor = RpcServer::Dispatch::onThreadPool(pool);
+
+	auto server = RpcServer::create(
+	                  transport_, method_,
+	                  [&ran_on](const v1::UMessage&) {
+		                  ran_on.set_value(std::this_thread::get_id());
+		                  return std::nullopt;
+	                  },
+	                  {}, {}, std::move(dispatch))
+	                  .value();
+
+	transport_->mockMessage(makeRequest());
+	auto future = ran_on.get_future();
+	ASSERT_EQ(future.wait_for(1s), std::future_status::ready);
+	EXPECT_NE(future.get(), std::this_thread::get_id());
+
+	// The server waits for the running callback to finish
+	server.reset();
+	EXPECT_EQ(transport_->send_count_, 1);
+}
 
 }  // namespace
@@ -560,4 +560,58 @@ TEST_F(PayloadTest, CopyAssignmentOperatorTest) {
 	EXPECT_EQ(copiedFormat, originalFormat);
 }
 
+// Shared payloads are not duplicated when the builder is copied
+TEST_F(PayloadTest, SharedPayloadCopiesShareDataTest) {
+	uprotocol::v1::UPayloadFormat format =
+	    uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT;
+	auto shared = std::make_shared<const Payload::Serialized>(
+	    testStringPayload_, format);
+
+	Payload originalPayload(shared);
+	Payload copiedPayload(originalPayload);
+	Payload assignedPayload(testStringPayload_, format);
+	assignedPayload = copiedPayload;
+
+	EXPECT_EQ(&originalPayload.buildCopy(), shared.get());
+	EXPECT_EQ(&copiedPayload.buildCopy(), shared.get());
+	EXPECT_EQ(&assignedPayload.buildCopy(), shared.get());
+
+	// Moving out copies the data, leaving it intact for the others
+	auto [movedData, movedFormat] = std::move(copiedPayload).buildMove();
+	EXPECT_EQ(movedData, testStringPayload_);
+	EXPECT_EQ(movedFormat, format);
+	EXPECT_EQ(std::get<Payload::PayloadType::Data>(*shared),
+	          testStringPayload_);
+	EXPECT_THROW(auto _ = copiedPayload.buildCopy(), Payload::PayloadMoved);
+	EXPECT_EQ(&originalPayload.buildCopy(), shared.get());
+}
+
+// Shared payload constructor rejects bad input
+TEST_F(PayloadTest, SharedPayloadInvalidTest) {
+	EXPECT_THROW(Payload(Payload::SharedSerialized{}), std::invalid_argument);
+	EXPECT_THROW(Payload(std::make_shared<const Payload::Serialized>(
+	                 testStringPayload_,
+	                 static_cast<uprotocol::v1::UPayloadFormat>(-1))),
+	             std::out_of_range);
+}
+
+// buildShared() moves owned data into a shared buffer without copying
+TEST_F(PayloadTest, BuildSharedTest) {
+	uprotocol::v1::UPayloadFormat format =
+	    uprotocol::v1::UPayloadFormat::UPAYLOAD_FORMAT_TEXT;
+	std::string data(1024, 'x');
+	const char* dataPtr = data.data();
+
+	Payload payload(std::move(data), format);
+	auto shared = std::move(payload).buildShared();
+	EXPECT_EQ(std::get<Payload::PayloadType::Data>(*shared).data(), dataPtr);
+	EXPECT_EQ(std::get<Payload::PayloadType::Format>(*shared), format);
+	EXPECT_THROW(auto _ = std::move(payload).buildShared(),
+	             Payload::PayloadMoved);
+
+	// A shared payload hands back the same buffer
+	Payload sharedPayload(shared);
+	EXPECT_EQ(std::move(sharedPayload).buildShared(), shared);
+}
+
 }  // namespace
@@ -15,6 +15,11 @@
 #include <up-cpp/datamodel/validator/UUri.h>
 #include <up-cpp/datamodel/validator/Uuid.h>
 
+#include <chrono>
+#include <set>
+#include <thread>
+#include <utility>
+
 namespace {
 using namespace uprotocol::v1;
 using namespace uprotocol::datamodel::serializer::uri;
@@ -259,6 +264,19 @@ TEST_F(TestUMessageBuilder, ResponseInvalidRequestIdThrows) {
 	    InvalidUuid);
 }
 
+TEST_F(TestUMessageBuilder, ResponseFromRequestUsesRequestId) {
+	auto request = createFakeRequest().build();
+
+	auto builder = UMessageBuilder::response(request);
+	const auto& attr = builder.attributes();
+	EXPECT_EQ(attr.type(), UMessageType::UMESSAGE_TYPE_RESPONSE);
+	EXPECT_EQ(attr.reqid().msb(), request.attributes().id().msb());
+	EXPECT_EQ(attr.reqid().lsb(), request.attributes().id().lsb());
+	EXPECT_TRUE(urisAreEqual(attr.sink(), request.attributes().source()));
+	EXPECT_TRUE(urisAreEqual(attr.source(), request.attributes().sink()));
+	EXPECT_EQ(attr.priority(), request.attributes().priority());
+}
+
 /// @brief withPriority test
 TEST_F(TestUMessageBuilder, WithPriorityValidForRequestOrResponseSuccess) {
 	auto builder = createFakeRequest();
@@ -494,4 +512,159 @@ TEST_F(TestUMessageBuilder, BuildWithPayloadMismatchedPayloadFormatThrows) {
 	    uprotocol::datamodel::builder::UMessageBuilder::UnexpectedFormat);
 }
 
+TEST_F(TestUMessageBuilder, WithIdPrefetchProducesUniqueIds) {
+	UUri topic = source_;
+	auto builder = UMessageBuilder::publish(std::move(topic));
+	builder.withIdPrefetch(16);
+	// Copies draw from the same block
+	auto copy = builder;
+
+	std::vector<UUID> ids;
+	for (int i = 0; i < 50; ++i) {
+		ids.push_back(builder.build().attributes().id());
+		ids.push_back(copy.build().attributes().id());
+	}
+
+	for (size_t i = 1; i < ids.size(); ++i) {
+		EXPECT_TRUE(std::get<0>(isUuid(ids[i])));
+		EXPECT_LT(ids[i - 1].msb(), ids[i].msb());
+	}
+}
+
+TEST_F(TestUMessageBuilder, WithIdPrefetchZeroDisables) {
+	UUri topic = source_;
+	auto builder = UMessageBuilder::publish(std::move(topic));
+	builder.withIdPrefetch(4).withIdPrefetch(0);
+
+	auto first = builder.build().attributes().id();
+	auto second = builder.build().attributes().id();
+	EXPECT_LT(first.msb(), second.msb());
+}
+
+// No more IDs than the counter can number in one tick are reserved at once,
+// and a reservation that ran short is refilled rather than repeating IDs
+TEST_F(TestUMessageBuilder, WithIdPrefetchLargeBlockStaysUnique) {
+	UUri topic = source_;
+	auto builder = UMessageBuilder::publish(std::move(topic));
+	builder.withIdPrefetch(10000);
+
+	std::set<std::pair<uint64_t, uint64_t>> ids;
+	constexpr size_t num_ids = 10000;
+	for (size_t i = 0; i < num_ids; ++i) {
+		auto id = builder.build().attributes().id();
+		ids.emplace(id.msb(), id.lsb());
+	}
+
+	EXPECT_EQ(ids.size(), num_ids);
+}
+
+// IDs left in a block from an earlier tick are not used, so messages built
+// after an idle period are not already expired
+TEST_F(TestUMessageBuilder, WithIdPrefetchDropsStaleIds) {
+	using namespace std::chrono_literals;
+	constexpr auto ttl = 10ms;
+
+	UUri topic = source_;
+	auto builder = UMessageBuilder::publish(std::move(topic));
+	builder.withIdPrefetch(16).withTtl(ttl);
+
+	auto first = builder.build().attributes().id();
+	std::this_thread::sleep_for(3 * ttl);
+	auto second = builder.build().attributes().id();
+
+	EXPECT_LT(first.msb(), second.msb());
+	EXPECT_GT(getTime(second), getTime(first) + ttl);
+	auto [expired, reason] = isExpired(second, ttl);
+	EXPECT_FALSE(expired);
+	EXPECT_FALSE(reason.has_value());
+}
+
+TEST_F(TestUMessageBuilder, BuildIntoOverwritesMessage) {
+	auto builder = createFakeRequest();
+	builder.withToken("token");
+	Payload payload(std::string("test-data"),
+	                UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+
+	// Start from a message with fields the request does not have
+	auto message = createFakeResponse().withCommStatus(UCode::INTERNAL).build(
+	    Payload(std::string("old-data"), UPayloadFormat::UPAYLOAD_FORMAT_RAW));
+	builder.buildInto(message, std::move(payload));
+
+	auto expected = builder.build(Payload(
+	    std::string("test-data"), UPayloadFormat::UPAYLOAD_FORMAT_TEXT));
+	*expected.mutable_attributes()->mutable_id() = message.attributes().id();
+	EXPECT_EQ(message.SerializeAsString(), expected.SerializeAsString());
+	EXPECT_TRUE(std::get<0>(isUuid(message.attributes().id())));
+
+	builder.buildInto(message);
+	EXPECT_FALSE(message.has_payload());
+	EXPECT_EQ(message.attributes().payload_format(),
+	          UPayloadFormat::UPAYLOAD_FORMAT_UNSPECIFIED);
+}
+
+TEST_F(TestUMessageBuilder, BuildIntoReusesStorage) {
+	UUri topic = source_;
+	topic.set_authority_name(std::string(64, 'a'));
+	auto builder = UMessageBuilder::publish(std::move(topic));
+
+	UMessage message;
+	builder.buildInto(message);
+	const auto* source = &message.attributes().source();
+	const auto* authority = message.attributes().source().authority_name().data();
+	auto firstId = message.attributes().id();
+
+	builder.buildInto(message);
+	EXPECT_EQ(&message.attributes().source(), source);
+	EXPECT_EQ(message.attributes().source().authority_name().data(), authority);
+	EXPECT_LT(firstId.msb(), message.attributes().id().msb());
+}
+
+TEST_F(TestUMessageBuilder, BuildIntoWithSharedPayload) {
+	auto builder = createFakeRequest();
+	auto shared = std::make_shared<const Payload::Serialized>(
+	    "test-data", UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	Payload payload(shared);
+
+	UMessage message;
+	builder.buildInto(message, std::move(payload));
+	EXPECT_EQ(message.payload(), "test-data");
+	EXPECT_EQ(message.attributes().payload_format(),
+	          UPayloadFormat::UPAYLOAD_FORMAT_TEXT);
+	EXPECT_EQ(std::get<Payload::PayloadType::Data>(*shared), "test-data");
+	EXPECT_THROW(auto _ = payload.buildCopy(), Payload::PayloadMoved);
+}
+
+TEST_F(TestUMessageBuilder, BuildIntoMismatchedPayloadFormatThrows) {
+	auto builder = createFakeRequest();
+	auto message = builder.build();
+	auto original = message.SerializeAsString();
+
+	builder.withPayloadFormat(UPayloadFormat::UPAYLOAD_FORMAT_JSON);
+	EXPECT_THROW(builder.buildInto(message), UMessageBuilder::UnexpectedFormat);
+	EXPECT_THROW(builder.buildInto(
+	                 message, Payload(std::string("test-data"),
+	                                  UPayloadFormat::UPAYLOAD_FORMAT_TEXT)),
+	             UMessageBuilder::UnexpectedFormat);
+	EXPECT_EQ(message.SerializeAsString(), original);
+}
+
+TEST_F(TestUMessageBuilder, BuildOnArena) {
+	auto builder = createFakeRequest();
+	google::protobuf::Arena arena;
+
+	auto* message = builder.build(arena);
+	EXPECT_EQ(message->GetArena(), &arena);
+	EXPECT_TRUE(urisAreEqual(message->attributes().source(), source_));
+	EXPECT_TRUE(urisAreEqual(message->attributes().sink(), sink_));
+	EXPECT_FALSE(message->has_payload());
+
+	auto* withPayload = builder.build(
+	    arena,
+	    Payload(std::string("test-data"), UPayloadFormat::UPAYLOAD_FORMAT_TEXT));
+	EXPECT_EQ(withPayload->GetArena(), &arena);
+	EXPECT_EQ(withPayload->payload(), "test-data");
+	EXPECT_LT(message->attributes().id().msb(),
+	          withPayload->attributes().id().msb());
+}
+
 }  // namespace
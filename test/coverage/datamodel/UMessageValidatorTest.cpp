@@ -770,4 +770,46 @@ TEST_F(TestUMessageValidator, ValidNotification) {
 	}
 }
 
+TEST_F(TestUMessageValidator, IsValidChecksRulesForMessageType) {
+	auto topic = source_;
+	topic.set_resource_id(0x8000);
+	auto response_sink = source_;
+	response_sink.set_resource_id(0);
+	auto notification_sink = sink_;
+	notification_sink.set_resource_id(0);
+
+	{
+		// valid messages of each type
+		for (auto attributes : {fakeRequest(response_sink, sink_),
+		                        fakeResponse(response_sink, sink_),
+		                        fakePublish(topic),
+		                        fakeNotification(topic, notification_sink)}) {
+			auto umessage = build(attributes);
+			auto [valid, reason] = isValid(umessage);
+			EXPECT_TRUE(valid);
+			EXPECT_FALSE(reason.has_value());
+		}
+	}
+
+	{
+		// reason comes from the rules for the message's own type
+		auto attributes = fakePublish(topic);
+		*attributes.mutable_sink() = sink_;
+		auto umessage = build(attributes);
+		auto [valid, reason] = isValid(umessage);
+		EXPECT_FALSE(valid);
+		EXPECT_EQ(reason, Reason::DISALLOWED_FIELD_SET);
+	}
+
+	{
+		// unspecified type
+		auto attributes = fakePublish(topic);
+		attributes.set_type(UMESSAGE_TYPE_UNSPECIFIED);
+		auto umessage = build(attributes);
+		auto [valid, reason] = isValid(umessage);
+		EXPECT_FALSE(valid);
+		EXPECT_EQ(reason, Reason::WRONG_MESSAGE_TYPE);
+	}
+}
+
 }  // namespace
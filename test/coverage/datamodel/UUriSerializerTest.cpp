@@ -12,6 +12,8 @@
 #include <gtest/gtest.h>
 #include <up-cpp/datamodel/serializer/UUri.h>
 
+#include <vector>
+
 namespace {
 using namespace uprotocol::datamodel::serializer::uri;
 using namespace uprotocol;
@@ -233,4 +235,112 @@ TEST_F(TestUUriSerializer, DeSerializeUUriStringWithWildcardArgument) {
 	ASSERT_THROW(AsString::deserialize(uuriAsString), std::invalid_argument);
 }
 
+// Test serialization into a reused string
+TEST_F(TestUUriSerializer, SerializeUUriIntoExistingString) {
+	std::string out = "previous contents that are longer than a uri";
+	AsString::serialize(buildValidTestURI(), out);
+	ASSERT_EQ(out, "//192.168.1.10/10010001/FE/7500");
+
+	auto testUUri = buildValidTestURI("");
+	testUUri.set_ue_id(0xABCDEF);
+	AsString::serialize(testUUri, out);
+	ASSERT_EQ(out, "/ABCDEF/FE/7500");
+}
+
+// Test serialization into a fixed-size buffer
+TEST_F(TestUUriSerializer, SerializeUUriIntoBuffer) {
+	char buffer[AsString::BUFFER_SIZE];
+	auto view = AsString::serialize(buildValidTestURI(), buffer);
+	ASSERT_EQ(view, "//192.168.1.10/10010001/FE/7500");
+	ASSERT_EQ(view.data(), buffer);
+
+	ASSERT_THROW(AsString::serialize(
+	                 buildValidTestURI(std::string(AsString::BUFFER_SIZE, 'a')),
+	                 buffer),
+	             std::length_error);
+}
+
+// Test that trusted serialization skips validation
+TEST_F(TestUUriSerializer, SerializeTrustedUUriSkipsValidation) {
+	auto testUUri = buildValidTestURI("*");
+	testUUri.set_ue_id(0xFFFF);
+	testUUri.set_ue_version_major(0xFF);
+	testUUri.set_resource_id(0xFFFF);
+	ASSERT_THROW(AsString::serialize(testUUri), std::invalid_argument);
+	ASSERT_EQ(AsString::serialize(testUUri, AsString::Validation::TRUSTED),
+	          "//*/FFFF/FF/FFFF");
+}
+
+// Test binary encoding layout
+TEST_F(TestUUriSerializer, SerializeUUriToBytes) {
+	auto bytes = AsBytes::serialize(buildValidTestURI("host"));
+	const std::vector<uint8_t> expected = {0x10, 0x01, 0x00, 0x01, 0x75, 0x00,
+	                                       0xFE, 0x04, 'h',  'o',  's',  't'};
+	ASSERT_EQ(bytes, expected);
+	ASSERT_EQ(AsBytes::serializedSize(buildValidTestURI("host")),
+	          expected.size());
+}
+
+// Test binary round trip through a caller-supplied buffer
+TEST_F(TestUUriSerializer, SerializeBytesRoundTripThroughBuffer) {
+	uint8_t buffer[AsBytes::MAX_SIZE];
+	for (const auto& authority : {"", "192.168.1.10", "*"}) {
+		auto uri = buildValidTestURI(authority);
+		const size_t size = AsBytes::serialize(uri, buffer, sizeof(buffer));
+		ASSERT_EQ(size, AsBytes::serializedSize(uri));
+
+		auto decoded = AsBytes::deserialize(buffer, sizeof(buffer));
+		ASSERT_EQ(decoded.SerializeAsString(), uri.SerializeAsString());
+	}
+}
+
+// Test that equal UUris have identical encodings and different ones do not
+TEST_F(TestUUriSerializer, SerializeBytesEqualityMatchesUUri) {
+	auto uri = buildValidTestURI();
+	ASSERT_EQ(AsBytes::serialize(uri), AsBytes::serialize(uri));
+
+	auto other = uri;
+	other.set_resource_id(uri.resource_id() + 1);
+	ASSERT_NE(AsBytes::serialize(uri), AsBytes::serialize(other));
+
+	other = uri;
+	other.set_authority_name(uri.authority_name() + "1");
+	ASSERT_NE(AsBytes::serialize(uri), AsBytes::serialize(other));
+}
+
+// Test that fields too large for the layout are rejected
+TEST_F(TestUUriSerializer, SerializeBytesRejectsOutOfRangeFields) {
+	auto uri = buildValidTestURI(std::string(AsBytes::MAX_AUTHORITY_SIZE + 1,
+	                                         'a'));
+	ASSERT_THROW(AsBytes::serialize(uri), std::invalid_argument);
+
+	uri = buildValidTestURI();
+	uri.set_resource_id(0x10000);
+	ASSERT_THROW(AsBytes::serialize(uri), std::invalid_argument);
+
+	uri = buildValidTestURI();
+	uri.set_ue_version_major(0x100);
+	ASSERT_THROW(AsBytes::serialize(uri), std::invalid_argument);
+
+	uint8_t buffer[AsBytes::HEADER_SIZE];
+	ASSERT_THROW(AsBytes::serialize(buildValidTestURI(), buffer, sizeof(buffer)),
+	             std::length_error);
+}
+
+// Test that truncated or oversized byte arrays are rejected
+TEST_F(TestUUriSerializer, DeserializeBytesRejectsBadSize) {
+	auto bytes = AsBytes::serialize(buildValidTestURI());
+
+	ASSERT_THROW(AsBytes::deserialize(std::vector<uint8_t>(
+	                 bytes.begin(), bytes.begin() + AsBytes::HEADER_SIZE - 1)),
+	             std::invalid_argument);
+	ASSERT_THROW(AsBytes::deserialize(
+	                 std::vector<uint8_t>(bytes.begin(), bytes.end() - 1)),
+	             std::invalid_argument);
+
+	bytes.push_back(0);
+	ASSERT_THROW(AsBytes::deserialize(bytes), std::invalid_argument);
+	ASSERT_NO_THROW(AsBytes::deserialize(bytes.data(), bytes.size()));
+}
+
 }  // namespace
@@ -12,6 +12,8 @@
 #include <gtest/gtest.h>
 #include <up-cpp/datamodel/validator/UUri.h>
 
+#include <vector>
+
 namespace {
 
 using namespace uprotocol::datamodel::validator::uri;
@@ -426,6 +428,76 @@ TEST_F(TestUUriValidator, ValidSubscription) {
 	}
 }
 
+TEST_F(TestUUriValidator, ValidFilter) {
+	auto getUuri = []() {
+		uprotocol::v1::UUri uuri;
+		uuri.set_authority_name(AUTHORITY_NAME);
+		uuri.set_ue_id(0x00010001);
+		uuri.set_ue_version_major(1);
+		uuri.set_resource_id(0x8000);
+		return uuri;
+	};
+
+	{
+		auto uuri = getUuri();
+		auto [valid, reason] = isValidFilter(uuri);
+		EXPECT_TRUE(valid);
+		EXPECT_FALSE(reason.has_value());
+	}
+
+	{
+		auto uuri = getUuri();
+		uuri.set_authority_name("*");
+		uuri.set_ue_id(0x0000FFFF);
+		uuri.set_ue_version_major(0xFF);
+		uuri.set_resource_id(0xFFFF);
+		auto [valid, reason] = isValidFilter(uuri);
+		EXPECT_TRUE(valid);
+		EXPECT_FALSE(reason.has_value());
+	}
+
+	{
+		auto uuri = getUuri();
+		uuri.set_resource_id(0xFFFF);
+		auto [valid, reason] = isValidFilter(uuri);
+		EXPECT_TRUE(valid);
+		EXPECT_FALSE(reason.has_value());
+	}
+
+	{
+		auto uuri = getUuri();
+		uuri.set_ue_version_major(0xFF);
+		uuri.set_resource_id(0x10000);
+		auto [valid, reason] = isValidFilter(uuri);
+		EXPECT_FALSE(valid);
+		EXPECT_TRUE(reason == Reason::BAD_RESOURCE_ID);
+	}
+
+	{
+		auto uuri = getUuri();
+		uuri.set_resource_id(0x10000);
+		auto [valid, reason] = isValidFilter(uuri);
+		EXPECT_FALSE(valid);
+	}
+
+	{
+		uprotocol::v1::UUri uuri;
+		auto [valid, reason] = isValidFilter(uuri);
+		EXPECT_FALSE(valid);
+		EXPECT_TRUE(reason == Reason::EMPTY);
+	}
+
+	// Only a bare "*" is an authority wildcard
+	for (const auto* authority : {"host*", "*.example.com", "**"}) {
+		auto uuri = getUuri();
+		uuri.set_authority_name(authority);
+		auto [valid, reason] = isValidFilter(uuri);
+		EXPECT_FALSE(valid) << authority;
+		EXPECT_TRUE(reason == Reason::DISALLOWED_WILDCARD) << authority;
+		EXPECT_FALSE(classify(uuri) & FILTER) << authority;
+	}
+}
+
 TEST_F(TestUUriValidator, ValidDefaultSource) {
 	auto getUuri = []() {
 		uprotocol::v1::UUri uuri;
@@ -503,4 +575,54 @@ TEST_F(TestUUriValidator, Empty) {
 	}
 }
 
+/// @brief Grid of URIs covering the boundaries of every field
+std::vector<uprotocol::v1::UUri> classifierTestUris() {
+	std::vector<uprotocol::v1::UUri> uris;
+	for (const char* authority : {"", "  ", AUTHORITY_NAME, "*"}) {
+		for (uint32_t ue_id :
+		     {0x0U, 0x1U, 0xFFFFU, 0x10000U, 0x10001U, 0x1FFFFU}) {
+			for (uint32_t version : {0x0U, 0x1U, 0xFFU, 0x100U}) {
+				for (uint32_t resource_id : {0x0U, 0x1U, 0x7FFFU, 0x8000U,
+				                             0xFFFEU, 0xFFFFU, 0x10000U}) {
+					uprotocol::v1::UUri uuri;
+					uuri.set_authority_name(authority);
+					uuri.set_ue_id(ue_id);
+					uuri.set_ue_version_major(version);
+					uuri.set_resource_id(resource_id);
+					uris.push_back(std::move(uuri));
+				}
+			}
+		}
+	}
+	return uris;
+}
+
+TEST_F(TestUUriValidator, ClassifyMatchesIndividualChecks) {
+	for (const auto& uuri : classifierTestUris()) {
+		const FormMask forms = classify(uuri);
+		const auto check = [&uuri](auto validator) {
+			return std::get<0>(validator(uuri));
+		};
+
+		EXPECT_EQ(bool(forms & RPC_METHOD), check(isValidRpcMethod));
+		EXPECT_EQ(bool(forms & RPC_RESPONSE), check(isValidRpcResponse));
+		EXPECT_EQ(bool(forms & DEFAULT_SOURCE), check(isValidDefaultSource));
+		EXPECT_EQ(bool(forms & PUBLISH_TOPIC), check(isValidPublishTopic));
+		EXPECT_EQ(bool(forms & NOTIFICATION), check(isValidNotification));
+		EXPECT_EQ(bool(forms & SUBSCRIPTION), check(isValidSubscription));
+
+		const bool any_form =
+		    check(isValidRpcMethod) || check(isValidRpcResponse) ||
+		    check(isValidPublishTopic) || check(isValidNotification);
+		EXPECT_EQ(check(isValid), any_form);
+
+		const bool filter =
+		    !check(isEmpty) && (uses_wildcards(uuri)
+		                            ? (uuri.resource_id() <= 0xFFFF)
+		                            : any_form);
+		EXPECT_EQ(bool(forms & FILTER), filter);
+		EXPECT_EQ(check(isValidFilter), filter) << uuri.ShortDebugString();
+	}
+}
+
 }  // namespace
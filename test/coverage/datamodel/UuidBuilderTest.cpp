@@ -11,6 +11,16 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "UTransportMock.h"
+#include "up-cpp/datamodel/builder/UMessage.h"
 #include "up-cpp/datamodel/builder/Uuid.h"
 #include "up-cpp/datamodel/constants/UuidConstants.h"
 
@@ -272,4 +282,178 @@ TEST(UuidBuilderTest, CustomTimeAndRandomSource) {
 	EXPECT_EQ(random_value, fixed_random);
 }
 
+// Copies of a builder share state and may be used from many threads at once
+TEST(UuidBuilderTest, ConcurrentBuildsAreUniqueAndMonotonic) {
+	constexpr size_t num_threads = 8;
+	constexpr size_t per_thread = 5000;
+
+	// Advance the clock by 1ms every 1000 calls so the counter regularly
+	// resets but never reaches its frozen maximum.
+	auto calls = std::make_shared<std::atomic<uint64_t>>(0);
+	auto builder =
+	    UuidBuilder::getTestBuilder().withIndependentState().withTimeSource(
+	        [calls]() {
+		        return std::chrono::system_clock::time_point(
+		            std::chrono::milliseconds(1234567890123 +
+		                                      (*calls)++ / 1000));
+	        });
+
+	std::vector<std::vector<std::pair<uint64_t, uint64_t>>> built(
+	    num_threads);
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < num_threads; ++t) {
+		threads.emplace_back([builder, &built, t]() mutable {
+			built[t].reserve(per_thread);
+			for (size_t i = 0; i < per_thread; ++i) {
+				auto uuid = builder.build();
+				built[t].emplace_back(uuid.msb(), uuid.lsb());
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	std::set<std::pair<uint64_t, uint64_t>> unique;
+	for (const auto& uuids : built) {
+		for (size_t i = 1; i < uuids.size(); ++i) {
+			EXPECT_LT(uuids[i - 1].first, uuids[i].first);
+		}
+		unique.insert(uuids.begin(), uuids.end());
+	}
+	EXPECT_EQ(unique.size(), num_threads * per_thread);
+}
+
+// Time going backwards must not reset the counter, or UUIDs would repeat
+TEST(UuidBuilderTest, ClockSteppingBackStaysMonotonic) {
+	auto offset = std::make_shared<int64_t>(1);
+	auto builder =
+	    UuidBuilder::getTestBuilder().withIndependentState().withTimeSource(
+	        [offset]() {
+		        return std::chrono::system_clock::time_point(
+		            std::chrono::milliseconds(1234567890123 + *offset));
+	        });
+
+	auto uuid1 = builder.build();
+	*offset = 0;
+	auto uuid2 = builder.build();
+
+	EXPECT_LT(uuid1.msb(), uuid2.msb());
+	EXPECT_EQ(uuid1.msb() >> UUID_TIMESTAMP_SHIFT,
+	          uuid2.msb() >> UUID_TIMESTAMP_SHIFT);
+	EXPECT_EQ(uuid2.msb() & UUID_COUNTER_MASK, 1);
+}
+
+// A clock set back by more than a small adjustment restarts from the new time
+// instead of holding every UUID at the old timestamp until it catches up
+TEST(UuidBuilderTest, ClockSteppingBackFarResets) {
+	auto offset = std::make_shared<int64_t>(3600 * 1000);
+	auto builder =
+	    UuidBuilder::getTestBuilder().withIndependentState().withTimeSource(
+	        [offset]() {
+		        return std::chrono::system_clock::time_point(
+		            std::chrono::milliseconds(1234567890123 + *offset));
+	        });
+
+	auto uuid1 = builder.build();
+	*offset = 0;
+	auto uuid2 = builder.build();
+	*offset = 1;
+	auto uuid3 = builder.build();
+
+	EXPECT_EQ(uuid2.msb() >> UUID_TIMESTAMP_SHIFT, 1234567890123);
+	EXPECT_EQ(uuid2.msb() & UUID_COUNTER_MASK, 0);
+	EXPECT_NE(uuid1.msb(), uuid2.msb());
+	// Time moving forward again is used right away
+	EXPECT_EQ(uuid3.msb() >> UUID_TIMESTAMP_SHIFT, 1234567890124);
+	EXPECT_LT(uuid2.msb(), uuid3.msb());
+}
+
+// UUIDs built after a larger step back must not be ahead of the clock, or
+// messages carrying them are rejected by the transport as invalid
+TEST(UuidBuilderTest, ClockSteppingBackStaysValid) {
+	auto offset = std::make_shared<std::chrono::milliseconds>(50);
+	auto builder =
+	    UuidBuilder::getTestBuilder().withIndependentState().withTimeSource(
+	        [offset]() { return std::chrono::system_clock::now() + *offset; });
+
+	static_cast<void>(builder.build());
+	*offset = std::chrono::milliseconds(0);
+	auto uuid = builder.build();
+
+	uprotocol::v1::UUri source;
+	source.set_authority_name("UuidBuilderTest");
+	source.set_ue_id(0x18000);
+	source.set_ue_version_major(1);
+	source.set_resource_id(0);
+	auto transport = std::make_shared<uprotocol::test::UTransportMock>(source);
+
+	uprotocol::v1::UUri topic = source;
+	topic.set_resource_id(0x8000);
+	auto message = UMessageBuilder::publish(std::move(topic)).build();
+	*message.mutable_attributes()->mutable_id() = uuid;
+
+	EXPECT_NO_THROW({
+		EXPECT_EQ(transport->send(message).code(), uprotocol::v1::UCode::OK);
+	});
+	EXPECT_EQ(transport->send_count_, 1);
+}
+
+auto fixedTimeBuilder() {
+	return UuidBuilder::getTestBuilder().withIndependentState().withTimeSource(
+	    []() {
+		    return std::chrono::system_clock::time_point(
+		        std::chrono::milliseconds(1234567890123));
+	    });
+}
+
+TEST(UuidBuilderTest, BuildBatchHasConsecutiveCounters) {
+	auto builder = fixedTimeBuilder();
+	auto single = builder.build();
+	auto batch = builder.buildBatch(10);
+	auto after = builder.build();
+
+	ASSERT_EQ(batch.size(), 10);
+	for (size_t i = 0; i < batch.size(); ++i) {
+		EXPECT_EQ(batch[i].msb() >> UUID_TIMESTAMP_SHIFT,
+		          single.msb() >> UUID_TIMESTAMP_SHIFT);
+		EXPECT_EQ(batch[i].msb() & UUID_COUNTER_MASK, i + 1);
+		EXPECT_EQ(batch[i].lsb(), single.lsb());
+	}
+	EXPECT_EQ(after.msb() & UUID_COUNTER_MASK, 11);
+}
+
+TEST(UuidBuilderTest, BuildBatchFreezesAtMaxValue) {
+	auto builder = fixedTimeBuilder();
+	builder.buildBatch(4090);
+
+	auto batch = builder.buildBatch(10);
+	ASSERT_EQ(batch.size(), 10);
+	for (size_t i = 0; i < 5; ++i) {
+		EXPECT_EQ(batch[i].msb() & UUID_COUNTER_MASK, 4090 + i);
+	}
+	for (size_t i = 5; i < batch.size(); ++i) {
+		EXPECT_EQ(batch[i].msb() & UUID_COUNTER_MASK, 4095);
+	}
+	EXPECT_EQ(builder.build().msb() & UUID_COUNTER_MASK, 4095);
+}
+
+TEST(UuidBuilderTest, BuildBatchInPlace) {
+	auto builder = fixedTimeBuilder();
+	std::vector<uprotocol::v1::UUID> uuids(5);
+	builder.buildBatch(uuids.data(), 3);
+
+	for (size_t i = 0; i < 3; ++i) {
+		EXPECT_EQ(uuids[i].msb() & UUID_COUNTER_MASK, i);
+		EXPECT_EQ((uuids[i].msb() >> UUID_VERSION_SHIFT) & UUID_VERSION_MASK,
+		          UUID_VERSION_8);
+	}
+	// Entries past the requested count are untouched
+	EXPECT_EQ(uuids[3].msb(), 0);
+	EXPECT_EQ(uuids[4].msb(), 0);
+
+	builder.buildBatch(uuids.data(), 0);
+	EXPECT_TRUE(builder.buildBatch(0).empty());
+}
+
 }  // namespace
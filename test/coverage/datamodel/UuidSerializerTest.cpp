@@ -286,4 +286,50 @@ TEST_F(TestUuidSerializer, SerializeDeserializeMaxValues) {
 	EXPECT_EQ(deserialized_uuid.lsb(), 0xFFFFFFFFFFFFFFFF);
 }
 
+// Test serialization into a caller-supplied buffer
+TEST_F(TestUuidSerializer, SerializeIntoBuffer) {
+	uprotocol::v1::UUID uuid;
+	uuid.set_msb(0x1234567890ABCDEF);
+	uuid.set_lsb(0xFEDCBA0987654321);
+
+	char buffer[uprotocol::datamodel::serializer::uuid::AsString::
+	                STRING_LENGTH];
+	uprotocol::datamodel::serializer::uuid::AsString::serialize(uuid, buffer);
+	EXPECT_EQ(std::string_view(buffer, sizeof(buffer)),
+	          "12345678-90ab-cdef-fedc-ba0987654321");
+}
+
+// Test deserialization from a view into a larger buffer
+TEST(DeserializerTest, DeserializeFromStringView) {
+	std::string_view line = "id=12345678-9abc-def0-fedc-ba9876543210;";
+	uprotocol::v1::UUID deserialized_uuid =
+	    uprotocol::datamodel::serializer::uuid::AsString::deserialize(
+	        line.substr(3, 36));
+	EXPECT_EQ(deserialized_uuid.msb(), 0x123456789ABCDEF0);
+	EXPECT_EQ(deserialized_uuid.lsb(), 0xFEDCBA9876543210);
+}
+
+// Test that every digit position rejects non-hex characters, including the
+// prefixes and signs that numeric parsing functions would accept
+TEST(DeserializerTest, DeserializeRejectsNonHexInAnyPosition) {
+	const std::string valid = "12345678-9abc-def0-fedc-ba9876543210";
+	for (size_t i = 0; i < valid.size(); ++i) {
+		if (valid[i] == '-') {
+			continue;
+		}
+		for (char c : {'g', 'x', '+', ' ', '\0'}) {
+			std::string invalid = valid;
+			invalid[i] = c;
+			EXPECT_THROW(
+			    uprotocol::datamodel::serializer::uuid::AsString::deserialize(
+			        invalid),
+			    std::invalid_argument)
+			    << "position " << i << " char " << static_cast<int>(c);
+		}
+	}
+	EXPECT_THROW(uprotocol::datamodel::serializer::uuid::AsString::deserialize(
+	                 "0x345678-9abc-def0-fedc-ba9876543210"),
+	             std::invalid_argument);
+}
+
 }  // namespace
@@ -274,4 +274,37 @@ TEST_F(TestUuidValidator, InvalidUuidElapsedTime) {
 	             validator::uuid::InvalidUuid);
 }
 
+// Checks against a caller-supplied time instead of the system clock
+TEST_F(TestUuidValidator, ChecksAgainstSuppliedTime) {
+	const auto now = std::chrono::system_clock::now();
+	uint64_t timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
+	                         now.time_since_epoch())
+	                         .count();
+	uint64_t msb = (8ULL << 12) | (timestamp << 16) | (0x123ULL);
+	uint64_t lsb = (2ULL << 62) | (0xFFFFFFFFFFFFULL);
+
+	uprotocol::v1::UUID uuid = createFakeUuid(msb, lsb);
+
+	{
+		auto [valid, reason] = validator::uuid::isUuid(uuid, now);
+		EXPECT_TRUE(valid);
+	}
+	{
+		auto [valid, reason] = validator::uuid::isUuid(uuid, now - 1s);
+		EXPECT_FALSE(valid);
+		EXPECT_EQ(reason, validator::uuid::Reason::FROM_THE_FUTURE);
+	}
+	{
+		auto [expired, reason] =
+		    validator::uuid::isExpired(uuid, 10s, now + 5s);
+		EXPECT_FALSE(expired);
+	}
+	{
+		auto [expired, reason] =
+		    validator::uuid::isExpired(uuid, 10s, now + 20s);
+		EXPECT_TRUE(expired);
+		EXPECT_EQ(reason, validator::uuid::Reason::EXPIRED);
+	}
+}
+
 }  // namespace
@@ -0,0 +1,360 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/transport/AsyncSender.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+using namespace uprotocol;
+using namespace std::chrono_literals;
+using uprotocol::datamodel::builder::Payload;
+using uprotocol::datamodel::builder::UMessageBuilder;
+using uprotocol::transport::AsyncSender;
+
+/// @brief Transport that records sent payloads and can be paused
+class GatedTransport : public transport::UTransport {
+public:
+	explicit GatedTransport(const v1::UUri& uri) : UTransport(uri) {}
+
+	/// @brief Blocks sendImpl() until release() is called
+	void hold() {
+		std::lock_guard lock(mutex_);
+		held_ = true;
+	}
+
+	void release() {
+		{
+			std::lock_guard lock(mutex_);
+			held_ = false;
+		}
+		cv_.notify_all();
+	}
+
+	/// @brief Waits for sendImpl() to be entered a number of times
+	bool waitForSends(size_t count) {
+		std::unique_lock lock(mutex_);
+		return cv_.wait_for(lock, 2s, [this, count]() {
+			return entered_ >= count;
+		});
+	}
+
+	std::vector<std::string> sent() {
+		std::lock_guard lock(mutex_);
+		return sent_;
+	}
+
+	/// @brief Makes sendImpl() throw std::runtime_error
+	std::atomic<bool> throw_on_send_{false};
+
+private:
+	[[nodiscard]] v1::UStatus sendImpl(const v1::UMessage& message) override {
+		std::unique_lock lock(mutex_);
+		++entered_;
+		cv_.notify_all();
+		cv_.wait(lock, [this]() { return !held_; });
+		if (throw_on_send_) {
+			throw std::runtime_error("transport failure");
+		}
+		sent_.push_back(message.payload());
+		return {};
+	}
+
+	[[nodiscard]] v1::UStatus registerListenerImpl(
+	    const v1::UUri&, CallableConn&&, std::optional<v1::UUri>&&) override {
+		return {};
+	}
+
+	std::mutex mutex_;
+	std::condition_variable cv_;
+	bool held_{false};
+	size_t entered_{0};
+	std::vector<std::string> sent_;
+};
+
+class TestAsyncSender : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		transport_ = std::make_shared<GatedTransport>(makeUri(0));
+	}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestAsyncSender() = default;
+	~TestAsyncSender() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static v1::UUri makeUri(uint32_t resource_id) {
+		v1::UUri uri;
+		uri.set_authority_name("10.0.0.1");
+		uri.set_ue_id(0x00010001);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(resource_id);
+		return uri;
+	}
+
+	static v1::UMessage makeMessage(
+	    const std::string& data,
+	    v1::UPriority priority = v1::UPriority::UPRIORITY_CS1) {
+		return UMessageBuilder::publish(makeUri(0x8001))
+		    .withPriority(priority)
+		    .build(Payload(data, v1::UPAYLOAD_FORMAT_TEXT));
+	}
+
+	/// @brief Occupies the sender thread with a held message
+	std::future<v1::UStatus> occupy(AsyncSender& sender) {
+		transport_->hold();
+		auto future = sender.sendAsync(makeMessage("blocker"));
+		EXPECT_TRUE(transport_->waitForSends(1));
+		return future;
+	}
+
+	std::shared_ptr<GatedTransport> transport_;
+};
+
+TEST_F(TestAsyncSender, SendsAndCompletes) {
+	AsyncSender sender(transport_);
+
+	auto future = sender.sendAsync(makeMessage("data"));
+	ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(future.get().code(), v1::UCode::OK);
+
+	std::promise<v1::UStatus> promise;
+	sender.sendAsync(makeMessage("callback"), [&promise](v1::UStatus status) {
+		promise.set_value(std::move(status));
+	});
+	auto callback_future = promise.get_future();
+	ASSERT_EQ(callback_future.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(callback_future.get().code(), v1::UCode::OK);
+
+	EXPECT_EQ(transport_->sent(), (std::vector<std::string>{"data", "callback"}));
+}
+
+TEST_F(TestAsyncSender, DrainsInPriorityOrder) {
+	AsyncSender sender(transport_);
+	auto blocker = occupy(sender);
+
+	std::vector<std::future<v1::UStatus>> futures;
+	futures.push_back(
+	    sender.sendAsync(makeMessage("low1", v1::UPriority::UPRIORITY_CS0)));
+	futures.push_back(
+	    sender.sendAsync(makeMessage("high", v1::UPriority::UPRIORITY_CS6)));
+	futures.push_back(
+	    sender.sendAsync(makeMessage("low2", v1::UPriority::UPRIORITY_CS0)));
+	futures.push_back(
+	    sender.sendAsync(makeMessage("mid", v1::UPriority::UPRIORITY_CS3)));
+	EXPECT_EQ(sender.queueSize(), 4);
+
+	transport_->release();
+	for (auto& future : futures) {
+		ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	}
+	EXPECT_EQ(transport_->sent(),
+	          (std::vector<std::string>{"blocker", "high", "mid", "low1",
+	                                    "low2"}));
+}
+
+TEST_F(TestAsyncSender, WeightedFairScheduling) {
+	AsyncSender::Scheduler::Weights weights{1, 1, 1, 1, 1, 1, 1, 2};
+	AsyncSender sender(transport_, AsyncSender::DEFAULT_QUEUE_SIZE,
+	                   AsyncSender::Backpressure::REJECT,
+	                   AsyncSender::Scheduler::Policy::WEIGHTED_FAIR, weights);
+	auto blocker = occupy(sender);
+
+	std::vector<std::future<v1::UStatus>> futures;
+	for (int i = 0; i < 3; ++i) {
+		futures.push_back(sender.sendAsync(
+		    makeMessage("low" + std::to_string(i), v1::UPRIORITY_CS0)));
+		futures.push_back(sender.sendAsync(
+		    makeMessage("high" + std::to_string(i), v1::UPRIORITY_CS6)));
+	}
+	EXPECT_EQ(sender.queueStats(v1::UPRIORITY_CS0).depth, 3);
+	EXPECT_EQ(sender.queueStats(v1::UPRIORITY_CS6).depth, 3);
+
+	transport_->release();
+	for (auto& future : futures) {
+		ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	}
+	EXPECT_EQ(transport_->sent(),
+	          (std::vector<std::string>{"blocker", "high0", "high1", "low0",
+	                                    "high2", "low1", "low2"}));
+	EXPECT_EQ(sender.queueStats(v1::UPRIORITY_CS6).dequeued, 3);
+	EXPECT_EQ(sender.queueStats(v1::UPRIORITY_CS0).depth, 0);
+}
+
+TEST_F(TestAsyncSender, RejectsWhenFull) {
+	AsyncSender sender(transport_, 1, AsyncSender::Backpressure::REJECT);
+	auto blocker = occupy(sender);
+
+	auto queued = sender.sendAsync(makeMessage("queued"));
+	auto rejected = sender.sendAsync(makeMessage("rejected"));
+	ASSERT_EQ(rejected.wait_for(0s), std::future_status::ready);
+	EXPECT_EQ(rejected.get().code(), v1::UCode::RESOURCE_EXHAUSTED);
+	EXPECT_EQ(sender.droppedCount(), 1);
+
+	transport_->release();
+	ASSERT_EQ(queued.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(queued.get().code(), v1::UCode::OK);
+}
+
+TEST_F(TestAsyncSender, DropsOldestLowestPriority) {
+	AsyncSender sender(transport_, 2, AsyncSender::Backpressure::DROP_OLDEST);
+	auto blocker = occupy(sender);
+
+	auto low = sender.sendAsync(makeMessage("low", v1::UPriority::UPRIORITY_CS0));
+	auto mid = sender.sendAsync(makeMessage("mid", v1::UPriority::UPRIORITY_CS3));
+	auto high =
+	    sender.sendAsync(makeMessage("high", v1::UPriority::UPRIORITY_CS6));
+	ASSERT_EQ(low.wait_for(0s), std::future_status::ready);
+	EXPECT_EQ(low.get().code(), v1::UCode::RESOURCE_EXHAUSTED);
+
+	// Lower priority messages cannot displace higher priority ones
+	auto lowest =
+	    sender.sendAsync(makeMessage("lowest", v1::UPriority::UPRIORITY_CS0));
+	ASSERT_EQ(lowest.wait_for(0s), std::future_status::ready);
+	EXPECT_EQ(lowest.get().code(), v1::UCode::RESOURCE_EXHAUSTED);
+	EXPECT_EQ(sender.droppedCount(), 2);
+
+	transport_->release();
+	ASSERT_EQ(high.wait_for(2s), std::future_status::ready);
+	ASSERT_EQ(mid.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(transport_->sent(),
+	          (std::vector<std::string>{"blocker", "high", "mid"}));
+}
+
+TEST_F(TestAsyncSender, BlocksWhenFull) {
+	AsyncSender sender(transport_, 1, AsyncSender::Backpressure::BLOCK);
+	auto blocker = occupy(sender);
+	auto queued = sender.sendAsync(makeMessage("queued"));
+
+	auto blocked = std::async(std::launch::async, [&sender, this]() {
+		return sender.sendAsync(makeMessage("blocked"));
+	});
+	EXPECT_EQ(blocked.wait_for(50ms), std::future_status::timeout);
+
+	transport_->release();
+	ASSERT_EQ(blocked.wait_for(2s), std::future_status::ready);
+	auto status = blocked.get();
+	ASSERT_EQ(status.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(status.get().code(), v1::UCode::OK);
+	EXPECT_EQ(sender.droppedCount(), 0);
+}
+
+TEST_F(TestAsyncSender, InvalidMessageReported) {
+	AsyncSender sender(transport_);
+
+	auto message = makeMessage("data");
+	*message.mutable_attributes()->mutable_sink() = makeUri(0);
+	auto future = sender.sendAsync(std::move(message));
+	ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(future.get().code(), v1::UCode::INVALID_ARGUMENT);
+	EXPECT_TRUE(transport_->sent().empty());
+}
+
+TEST_F(TestAsyncSender, SendExceptionReportedInternal) {
+	AsyncSender sender(transport_);
+
+	transport_->throw_on_send_ = true;
+	auto failed = sender.sendAsync(makeMessage("fails"));
+	ASSERT_EQ(failed.wait_for(2s), std::future_status::ready);
+	const auto status = failed.get();
+	EXPECT_EQ(status.code(), v1::UCode::INTERNAL);
+	EXPECT_EQ(status.message(), "transport failure");
+
+	// The sender thread keeps running
+	transport_->throw_on_send_ = false;
+	auto sent = sender.sendAsync(makeMessage("sent"));
+	ASSERT_EQ(sent.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(sent.get().code(), v1::UCode::OK);
+}
+
+TEST_F(TestAsyncSender, CallbackExceptionsContained) {
+	auto throwing = [](v1::UStatus) {
+		throw std::runtime_error("callback failure");
+	};
+	auto sender = std::make_unique<AsyncSender>(transport_, 1);
+
+	auto blocker = occupy(*sender);
+	// Completes on the sender thread once released
+	sender->sendAsync(makeMessage("queued"), throwing);
+	// Rejected on this thread because the queue is full
+	EXPECT_NO_THROW(sender->sendAsync(makeMessage("rejected"), throwing));
+	transport_->release();
+	ASSERT_EQ(blocker.wait_for(2s), std::future_status::ready);
+
+	// The sender thread survived the callback
+	auto after = sender->sendAsync(makeMessage("after"));
+	ASSERT_EQ(after.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(after.get().code(), v1::UCode::OK);
+
+	// Cancelled by the destructor
+	transport_->hold();
+	auto last = sender->sendAsync(makeMessage("last"));
+	ASSERT_TRUE(transport_->waitForSends(4));
+	sender->sendAsync(makeMessage("cancelled"), throwing);
+	auto destroyed =
+	    std::async(std::launch::async, [&sender]() { sender.reset(); });
+	// Waits for the in-flight message
+	EXPECT_EQ(destroyed.wait_for(50ms), std::future_status::timeout);
+	transport_->release();
+	ASSERT_EQ(destroyed.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(last.get().code(), v1::UCode::OK);
+	EXPECT_EQ(transport_->sent(),
+	          (std::vector<std::string>{"blocker", "queued", "after", "last"}));
+}
+
+TEST_F(TestAsyncSender, NullCallbackThrows) {
+	AsyncSender sender(transport_);
+	EXPECT_THROW(sender.sendAsync(makeMessage("data"), nullptr),
+	             std::invalid_argument);
+	EXPECT_EQ(sender.queueSize(), 0);
+}
+
+TEST_F(TestAsyncSender, DestructorCancelsQueued) {
+	std::future<v1::UStatus> blocker;
+	std::future<v1::UStatus> queued;
+	{
+		auto sender = std::make_unique<AsyncSender>(transport_);
+		blocker = occupy(*sender);
+		queued = sender->sendAsync(makeMessage("queued"));
+
+		auto destroyed = std::async(std::launch::async,
+		                            [&sender]() { sender.reset(); });
+		// The in-flight message is allowed to finish
+		EXPECT_EQ(destroyed.wait_for(50ms), std::future_status::timeout);
+		transport_->release();
+		ASSERT_EQ(destroyed.wait_for(2s), std::future_status::ready);
+	}
+
+	EXPECT_EQ(blocker.get().code(), v1::UCode::OK);
+	EXPECT_EQ(queued.get().code(), v1::UCode::CANCELLED);
+}
+
+TEST_F(TestAsyncSender, NullTransportThrows) {
+	EXPECT_THROW(AsyncSender(nullptr), std::invalid_argument);
+}
+
+}  // namespace
@@ -0,0 +1,301 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/transport/LoopbackTransport.h>
+
+#include <memory>
+#include <vector>
+
+using MsgDiff = google::protobuf::util::MessageDifferencer;
+
+namespace {
+using namespace uprotocol;
+using namespace uprotocol::datamodel::builder;
+using uprotocol::transport::LoopbackTransport;
+
+class TestLoopbackTransport : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		v1::UUri def_src;
+		def_src.set_authority_name("10.0.0.1");
+		def_src.set_ue_id(0x00010001);
+		def_src.set_ue_version_major(1);
+		def_src.set_resource_id(0);
+		transport_ = std::make_shared<LoopbackTransport>(def_src);
+	}
+
+	void TearDown() override { transport_.reset(); }
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestLoopbackTransport() = default;
+	~TestLoopbackTransport() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static v1::UUri makeUri(uint32_t ue_id, uint32_t resource_id,
+	                        const std::string& authority = "10.0.0.1") {
+		v1::UUri uri;
+		uri.set_authority_name(authority);
+		uri.set_ue_id(ue_id);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(resource_id);
+		return uri;
+	}
+
+	static v1::UMessage makePublish(const v1::UUri& topic) {
+		v1::UUri t = topic;
+		return UMessageBuilder::publish(std::move(t))
+		    .build(Payload(std::string("data"), v1::UPAYLOAD_FORMAT_TEXT));
+	}
+
+	std::shared_ptr<LoopbackTransport> transport_;
+};
+
+TEST_F(TestLoopbackTransport, PublishReachesListener) {
+	auto topic = makeUri(0x00010002, 0x8001);
+
+	std::vector<v1::UMessage> received;
+	auto handle = transport_->registerListener(
+	    topic, [&received](const v1::UMessage& m) { received.push_back(m); });
+	ASSERT_TRUE(handle.has_value());
+	EXPECT_EQ(transport_->listenerCount(), 1);
+
+	auto msg = makePublish(topic);
+	auto status = transport_->send(msg);
+	EXPECT_EQ(status.code(), v1::UCode::OK);
+	ASSERT_EQ(received.size(), 1);
+	EXPECT_TRUE(MsgDiff::Equals(msg, received.front()));
+}
+
+TEST_F(TestLoopbackTransport, NonMatchingListenerNotCalled) {
+	size_t calls = 0;
+	auto handle = transport_->registerListener(
+	    makeUri(0x00010002, 0x8002),
+	    [&calls](const v1::UMessage&) { ++calls; });
+	ASSERT_TRUE(handle.has_value());
+
+	auto status = transport_->send(makePublish(makeUri(0x00010002, 0x8001)));
+	EXPECT_EQ(status.code(), v1::UCode::OK);
+	EXPECT_EQ(calls, 0);
+
+	status = transport_->send(
+	    makePublish(makeUri(0x00010002, 0x8002, "10.0.0.2")));
+	EXPECT_EQ(status.code(), v1::UCode::OK);
+	EXPECT_EQ(calls, 0);
+}
+
+TEST_F(TestLoopbackTransport, SourceFilterApplied) {
+	auto source = makeUri(0x00010003, 0x8001);
+	auto sink = makeUri(0x00010004, 0x8001);
+	auto other_source = makeUri(0x00010005, 0x8001);
+
+	size_t calls = 0;
+	auto handle = transport_->registerListener(
+	    sink, [&calls](const v1::UMessage&) { ++calls; }, v1::UUri(source));
+	ASSERT_TRUE(handle.has_value());
+
+	{
+		v1::UUri src = source;
+		v1::UUri snk = sink;
+		auto msg = UMessageBuilder::notification(std::move(src),
+		                                         std::move(snk))
+		               .build();
+		EXPECT_EQ(transport_->send(msg).code(), v1::UCode::OK);
+	}
+	EXPECT_EQ(calls, 1);
+
+	{
+		v1::UUri src = other_source;
+		v1::UUri snk = sink;
+		auto msg = UMessageBuilder::notification(std::move(src),
+		                                         std::move(snk))
+		               .build();
+		EXPECT_EQ(transport_->send(msg).code(), v1::UCode::OK);
+	}
+	EXPECT_EQ(calls, 1);
+}
+
+TEST_F(TestLoopbackTransport, ResetHandleRemovesListener) {
+	auto topic = makeUri(0x00010002, 0x8001);
+	auto other_topic = makeUri(0x00010002, 0x8002);
+
+	size_t calls = 0;
+	auto handle = transport_->registerListener(
+	    topic, [&calls](const v1::UMessage&) { ++calls; });
+	auto other_handle = transport_->registerListener(
+	    other_topic, [&calls](const v1::UMessage&) { ++calls; });
+	ASSERT_TRUE(handle.has_value());
+	ASSERT_TRUE(other_handle.has_value());
+	EXPECT_EQ(transport_->listenerCount(), 2);
+
+	EXPECT_EQ(transport_->send(makePublish(topic)).code(), v1::UCode::OK);
+	EXPECT_EQ(calls, 1);
+
+	auto h = std::move(handle).value();
+	h.reset();
+	EXPECT_EQ(transport_->listenerCount(), 1);
+
+	EXPECT_EQ(transport_->send(makePublish(topic)).code(), v1::UCode::OK);
+	EXPECT_EQ(calls, 1);
+
+	EXPECT_EQ(transport_->send(makePublish(other_topic)).code(),
+	          v1::UCode::OK);
+	EXPECT_EQ(calls, 2);
+
+	auto oh = std::move(other_handle).value();
+	oh.reset();
+	EXPECT_EQ(transport_->listenerCount(), 0);
+}
+
+TEST_F(TestLoopbackTransport, ManyListenersOnlyMatchingCalled) {
+	constexpr size_t num_topics = 500;
+
+	std::vector<size_t> calls(num_topics, 0);
+	std::vector<LoopbackTransport::ListenHandle> handles;
+	for (size_t i = 0; i < num_topics; ++i) {
+		auto result = transport_->registerListener(
+		    makeUri(0x00010002, 0x8000 + i),
+		    [&calls, i](const v1::UMessage&) { ++calls[i]; });
+		ASSERT_TRUE(result.has_value());
+		handles.push_back(std::move(result).value());
+	}
+	EXPECT_EQ(transport_->listenerCount(), num_topics);
+
+	for (size_t i = 0; i < num_topics; i += 7) {
+		auto status =
+		    transport_->send(makePublish(makeUri(0x00010002, 0x8000 + i)));
+		EXPECT_EQ(status.code(), v1::UCode::OK);
+	}
+
+	for (size_t i = 0; i < num_topics; ++i) {
+		EXPECT_EQ(calls[i], (i % 7 == 0) ? 1 : 0);
+	}
+
+	handles.clear();
+	EXPECT_EQ(transport_->listenerCount(), 0);
+}
+
+TEST_F(TestLoopbackTransport, WildcardSinkFilterMatches) {
+	size_t any_resource = 0;
+	size_t any_authority = 0;
+	size_t any_service = 0;
+	auto h1 = transport_->registerListener(
+	    makeUri(0x00010002, 0xFFFF),
+	    [&any_resource](const v1::UMessage&) { ++any_resource; });
+	auto h2 = transport_->registerListener(
+	    makeUri(0x00010002, 0x8001, "*"),
+	    [&any_authority](const v1::UMessage&) { ++any_authority; });
+	auto h3 = transport_->registerListener(
+	    makeUri(0x0001FFFF, 0x8001),
+	    [&any_service](const v1::UMessage&) { ++any_service; });
+	ASSERT_TRUE(h1.has_value());
+	ASSERT_TRUE(h2.has_value());
+	ASSERT_TRUE(h3.has_value());
+
+	auto publish = [this](const v1::UUri& topic) {
+		EXPECT_EQ(transport_->send(makePublish(topic)).code(), v1::UCode::OK);
+	};
+
+	publish(makeUri(0x00010002, 0x8001));
+	EXPECT_EQ(any_resource, 1);
+	EXPECT_EQ(any_authority, 1);
+	EXPECT_EQ(any_service, 1);
+
+	publish(makeUri(0x00010002, 0x8002));
+	EXPECT_EQ(any_resource, 2);
+	EXPECT_EQ(any_authority, 1);
+	EXPECT_EQ(any_service, 1);
+
+	publish(makeUri(0x00010002, 0x8001, "10.0.0.2"));
+	EXPECT_EQ(any_resource, 2);
+	EXPECT_EQ(any_authority, 2);
+	EXPECT_EQ(any_service, 1);
+
+	publish(makeUri(0x00010007, 0x8001));
+	EXPECT_EQ(any_resource, 2);
+	EXPECT_EQ(any_authority, 2);
+	EXPECT_EQ(any_service, 2);
+}
+
+TEST_F(TestLoopbackTransport, WildcardSourceFilterApplied) {
+	auto sink = makeUri(0x00010004, 0x8001);
+
+	size_t calls = 0;
+	auto handle = transport_->registerListener(
+	    sink, [&calls](const v1::UMessage&) { ++calls; },
+	    makeUri(0x0001FFFF, 0xFFFF));
+	ASSERT_TRUE(handle.has_value());
+
+	auto send_from = [this, &sink](v1::UUri&& source) {
+		v1::UUri snk = sink;
+		auto msg =
+		    UMessageBuilder::notification(std::move(source), std::move(snk))
+		        .build();
+		EXPECT_EQ(transport_->send(msg).code(), v1::UCode::OK);
+	};
+
+	send_from(makeUri(0x00010003, 0x8001));
+	EXPECT_EQ(calls, 1);
+	send_from(makeUri(0x00010005, 0x8002));
+	EXPECT_EQ(calls, 2);
+	send_from(makeUri(0x00020005, 0x8002));
+	EXPECT_EQ(calls, 2);
+}
+
+TEST_F(TestLoopbackTransport, ListenerCanSendResponse) {
+	auto method = makeUri(0x00010002, 0x0101);
+	auto client = makeUri(0x00010003, 0);
+
+	auto server_handle = transport_->registerListener(
+	    method, [this](const v1::UMessage& request) {
+		    v1::UUri sink = request.attributes().source();
+		    v1::UUri source = request.attributes().sink();
+		    v1::UUID reqid = request.attributes().id();
+		    auto response =
+		        UMessageBuilder::response(std::move(sink), std::move(reqid),
+		                                  request.attributes().priority(),
+		                                  std::move(source))
+		            .build();
+		    EXPECT_EQ(transport_->send(response).code(), v1::UCode::OK);
+	    });
+	ASSERT_TRUE(server_handle.has_value());
+
+	std::optional<v1::UMessage> response;
+	auto client_handle = transport_->registerListener(
+	    client, [&response](const v1::UMessage& m) { response = m; },
+	    v1::UUri(method));
+	ASSERT_TRUE(client_handle.has_value());
+
+	v1::UUri m = method;
+	v1::UUri c = client;
+	auto request =
+	    UMessageBuilder::request(std::move(m), std::move(c),
+	                             v1::UPRIORITY_CS4, std::chrono::seconds(1))
+	        .build();
+	EXPECT_EQ(transport_->send(request).code(), v1::UCode::OK);
+
+	ASSERT_TRUE(response.has_value());
+	EXPECT_EQ(response->attributes().type(), v1::UMESSAGE_TYPE_RESPONSE);
+	EXPECT_TRUE(
+	    MsgDiff::Equals(response->attributes().reqid(),
+	                    request.attributes().id()));
+}
+
+}  // namespace
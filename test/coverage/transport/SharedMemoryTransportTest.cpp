@@ -0,0 +1,273 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <google/protobuf/util/message_differencer.h>
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <up-cpp/datamodel/builder/UMessage.h>
+#include <up-cpp/transport/SharedMemoryTransport.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using MsgDiff = google::protobuf::util::MessageDifferencer;
+
+namespace {
+using namespace uprotocol;
+using namespace uprotocol::datamodel::builder;
+using uprotocol::transport::SharedMemoryTransport;
+
+constexpr auto RECEIVE_TIMEOUT = std::chrono::seconds(2);
+
+/// @brief Collects received messages and lets the test wait for them
+struct Receiver {
+	void operator()(const v1::UMessage& message) {
+		std::lock_guard lock(mtx);
+		messages.push_back(message);
+		cv.notify_all();
+	}
+
+	bool waitFor(size_t count) {
+		std::unique_lock lock(mtx);
+		return cv.wait_for(lock, RECEIVE_TIMEOUT,
+		                   [this, count]() { return messages.size() >= count; });
+	}
+
+	std::mutex mtx;
+	std::condition_variable cv;
+	std::vector<v1::UMessage> messages;
+};
+
+class TestSharedMemoryTransport : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {
+		config_.name = "/up-cpp-test-" + std::to_string(getpid()) + "-" +
+		               testing::UnitTest::GetInstance()
+		                   ->current_test_info()
+		                   ->name();
+		config_.slot_count = 64;
+		config_.slot_size = 1024;
+		SharedMemoryTransport::remove(config_.name);
+	}
+
+	void TearDown() override { SharedMemoryTransport::remove(config_.name); }
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestSharedMemoryTransport() = default;
+	~TestSharedMemoryTransport() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static v1::UUri makeUri(uint32_t ue_id, uint32_t resource_id) {
+		v1::UUri uri;
+		uri.set_authority_name("10.0.0.1");
+		uri.set_ue_id(ue_id);
+		uri.set_ue_version_major(1);
+		uri.set_resource_id(resource_id);
+		return uri;
+	}
+
+	static v1::UMessage makePublish(const v1::UUri& topic,
+	                                std::string&& data = "data") {
+		v1::UUri t = topic;
+		return UMessageBuilder::publish(std::move(t))
+		    .build(Payload(std::move(data), v1::UPAYLOAD_FORMAT_TEXT));
+	}
+
+	std::shared_ptr<SharedMemoryTransport> makeTransport(uint32_t ue_id) {
+		return std::make_shared<SharedMemoryTransport>(makeUri(ue_id, 0),
+		                                               config_);
+	}
+
+	SharedMemoryTransport::Config config_;
+};
+
+TEST_F(TestSharedMemoryTransport, DeliversBetweenInstances) {
+	auto publisher = makeTransport(0x00010001);
+	auto subscriber = makeTransport(0x00010002);
+	auto topic = makeUri(0x00010001, 0x8001);
+
+	Receiver receiver;
+	auto handle = subscriber->registerListener(
+	    topic, [&receiver](const v1::UMessage& m) { receiver(m); });
+	ASSERT_TRUE(handle.has_value());
+
+	auto msg = makePublish(topic);
+	EXPECT_EQ(publisher->send(msg).code(), v1::UCode::OK);
+
+	ASSERT_TRUE(receiver.waitFor(1));
+	EXPECT_TRUE(MsgDiff::Equals(msg, receiver.messages.front()));
+	EXPECT_EQ(subscriber->droppedCount(), 0);
+}
+
+TEST_F(TestSharedMemoryTransport, DeliversToOwnListeners) {
+	auto transport = makeTransport(0x00010001);
+	auto topic = makeUri(0x00010001, 0x8001);
+
+	Receiver receiver;
+	auto handle = transport->registerListener(
+	    topic, [&receiver](const v1::UMessage& m) { receiver(m); });
+	ASSERT_TRUE(handle.has_value());
+
+	EXPECT_EQ(transport->send(makePublish(topic)).code(), v1::UCode::OK);
+	EXPECT_TRUE(receiver.waitFor(1));
+}
+
+TEST_F(TestSharedMemoryTransport, PreservesOrderAcrossWraparound) {
+	auto publisher = makeTransport(0x00010001);
+	auto subscriber = makeTransport(0x00010002);
+	auto topic = makeUri(0x00010001, 0x8001);
+
+	Receiver receiver;
+	auto handle = subscriber->registerListener(
+	    topic, [&receiver](const v1::UMessage& m) { receiver(m); });
+	ASSERT_TRUE(handle.has_value());
+
+	// Several laps of the ring, pacing so the receiver can keep up.
+	constexpr size_t num_messages = 64 * 4;
+	for (size_t i = 0; i < num_messages; ++i) {
+		EXPECT_EQ(
+		    publisher->send(makePublish(topic, std::to_string(i))).code(),
+		    v1::UCode::OK);
+		if ((i % 16) == 15) {
+			ASSERT_TRUE(receiver.waitFor(i + 1));
+		}
+	}
+
+	ASSERT_TRUE(receiver.waitFor(num_messages));
+	EXPECT_EQ(subscriber->droppedCount(), 0);
+	for (size_t i = 0; i < receiver.messages.size(); ++i) {
+		EXPECT_EQ(receiver.messages[i].payload(), std::to_string(i));
+	}
+}
+
+TEST_F(TestSharedMemoryTransport, ReclaimsSlotFromDeadWriter) {
+	config_.stale_write_timeout = std::chrono::milliseconds(20);
+	auto publisher = makeTransport(0x00010001);
+	auto subscriber = makeTransport(0x00010002);
+	auto topic = makeUri(0x00010001, 0x8001);
+
+	Receiver receiver;
+	auto handle = subscriber->registerListener(
+	    topic, [&receiver](const v1::UMessage& m) { receiver(m); });
+	ASSERT_TRUE(handle.has_value());
+
+	{
+		// Play a writer that claims sequence 0, marks its slot as being
+		// written, then dies.
+		using Layout = SharedMemoryTransport::Layout;
+		const int fd = shm_open(config_.name.c_str(), O_RDWR, 0);
+		ASSERT_GE(fd, 0);
+		void* mapping =
+		    mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		close(fd);
+		ASSERT_NE(mapping, MAP_FAILED);
+		auto* base = static_cast<uint8_t*>(mapping);
+		auto word = [base](size_t offset) {
+			return reinterpret_cast<std::atomic<uint64_t>*>(base + offset);
+		};
+		word(Layout::WRITE_SEQ_OFFSET)->fetch_add(1);
+		word(Layout::HEADER_SIZE)->store(Layout::writingState(0));
+		munmap(mapping, 4096);
+	}
+
+	// The last message wraps around onto the abandoned slot. Without
+	// reclaiming, it would wait forever and the receiver would never get
+	// past sequence 0.
+	for (size_t i = 1; i <= config_.slot_count; ++i) {
+		EXPECT_EQ(
+		    publisher->send(makePublish(topic, std::to_string(i))).code(),
+		    v1::UCode::OK);
+	}
+
+	ASSERT_TRUE(receiver.waitFor(config_.slot_count));
+	EXPECT_EQ(subscriber->droppedCount(), 1);
+	EXPECT_EQ(receiver.messages.front().payload(), "1");
+	EXPECT_EQ(receiver.messages.back().payload(),
+	          std::to_string(config_.slot_count));
+}
+
+TEST_F(TestSharedMemoryTransport, OversizedMessageRejected) {
+	auto transport = makeTransport(0x00010001);
+	EXPECT_EQ(transport->maxMessageSize(), config_.slot_size);
+
+	auto msg = makePublish(makeUri(0x00010001, 0x8001),
+	                       std::string(config_.slot_size, 'x'));
+	EXPECT_EQ(transport->send(msg).code(), v1::UCode::RESOURCE_EXHAUSTED);
+}
+
+TEST_F(TestSharedMemoryTransport, SendBatchPreservesOrder) {
+	auto publisher = makeTransport(0x00010001);
+	auto subscriber = makeTransport(0x00010002);
+	auto topic = makeUri(0x00010001, 0x8001);
+
+	Receiver receiver;
+	auto handle = subscriber->registerListener(
+	    topic, [&receiver](const v1::UMessage& m) { receiver(m); });
+	ASSERT_TRUE(handle.has_value());
+
+	std::vector<v1::UMessage> batch;
+	for (int i = 0; i < 8; ++i) {
+		batch.push_back(makePublish(topic, std::to_string(i)));
+	}
+	// Oversized messages are rejected without affecting the rest
+	batch[3] = makePublish(topic, std::string(config_.slot_size, 'x'));
+
+	auto statuses = publisher->sendBatch(batch);
+	ASSERT_EQ(statuses.size(), batch.size());
+	for (size_t i = 0; i < statuses.size(); ++i) {
+		EXPECT_EQ(statuses[i].code(),
+		          (i == 3) ? v1::UCode::RESOURCE_EXHAUSTED : v1::UCode::OK);
+	}
+
+	ASSERT_TRUE(receiver.waitFor(batch.size() - 1));
+	EXPECT_EQ(subscriber->droppedCount(), 0);
+	std::vector<std::string> expected{"0", "1", "2", "4", "5", "6", "7"};
+	ASSERT_EQ(receiver.messages.size(), expected.size());
+	for (size_t i = 0; i < expected.size(); ++i) {
+		EXPECT_EQ(receiver.messages[i].payload(), expected[i]);
+	}
+}
+
+TEST_F(TestSharedMemoryTransport, AdoptsExistingGeometry) {
+	auto first = makeTransport(0x00010001);
+
+	auto different = config_;
+	different.slot_size = config_.slot_size * 4;
+	SharedMemoryTransport second(makeUri(0x00010002, 0), different);
+	EXPECT_EQ(second.maxMessageSize(), config_.slot_size);
+}
+
+TEST_F(TestSharedMemoryTransport, InvalidConfigThrows) {
+	auto bad_name = config_;
+	bad_name.name = "no-leading-slash";
+	EXPECT_THROW(SharedMemoryTransport(makeUri(0x00010001, 0), bad_name),
+	             std::invalid_argument);
+
+	auto bad_count = config_;
+	bad_count.slot_count = 100;
+	EXPECT_THROW(SharedMemoryTransport(makeUri(0x00010001, 0), bad_count),
+	             std::invalid_argument);
+}
+
+}  // namespace
@@ -13,6 +13,7 @@
 #include <fcntl.h>
 #include <google/protobuf/util/message_differencer.h>
 #include <gtest/gtest.h>
+#include <up-cpp/datamodel/validator/UMessage.h>
 #include <unistd.h>
 
 #include <memory>
@@ -179,4 +180,149 @@ TEST_F(TestMockUTransport, registerListener) {
 	}
 }
 
+uprotocol::v1::UMessage make_publish_message() {
+	auto src = new uprotocol::v1::UUri();
+	src->set_authority_name("10.0.0.1");
+	src->set_ue_id(0x00010001);
+	src->set_ue_version_major(1);
+	src->set_resource_id(0x8000);
+
+	auto attr = new uprotocol::v1::UAttributes();
+	attr->set_type(uprotocol::v1::UMESSAGE_TYPE_PUBLISH);
+	attr->set_allocated_id(make_uuid());
+	attr->set_allocated_source(src);
+	attr->set_payload_format(uprotocol::v1::UPAYLOAD_FORMAT_PROTOBUF);
+	attr->set_ttl(1000);
+
+	uprotocol::v1::UMessage msg;
+	msg.set_allocated_attributes(attr);
+	return msg;
+}
+
+TEST_F(TestMockUTransport, ValidationPolicy) {
+	using Policy = uprotocol::transport::UTransport::ValidationPolicy;
+	using uprotocol::datamodel::validator::message::InvalidUMessage;
+
+	uprotocol::v1::UUri def_src_uuri;
+	def_src_uuri.set_authority_name(get_random_string());
+	def_src_uuri.set_ue_id(0x18000);
+	def_src_uuri.set_ue_version_major(1);
+	def_src_uuri.set_resource_id(0);
+
+	uprotocol::test::UTransportMock transport(def_src_uuri);
+	EXPECT_EQ(transport.getValidationPolicy(), Policy::ALWAYS);
+
+	// Publish messages must not have a sink
+	auto malformed = make_publish_message();
+	*malformed.mutable_attributes()->mutable_sink() = def_src_uuri;
+
+	// Expired one second ago
+	auto expired = make_publish_message();
+	expired.mutable_attributes()->mutable_id()->set_msb(
+	    expired.attributes().id().msb() - (2000ULL << 16));
+
+	EXPECT_THROW(static_cast<void>(transport.send(malformed)),
+	             InvalidUMessage);
+	EXPECT_THROW(static_cast<void>(transport.send(expired)), InvalidUMessage);
+
+	transport.setValidationPolicy(Policy::TRUSTED);
+	EXPECT_EQ(transport.getValidationPolicy(), Policy::TRUSTED);
+	EXPECT_NO_THROW(static_cast<void>(transport.send(malformed)));
+	EXPECT_THROW(static_cast<void>(transport.send(expired)), InvalidUMessage);
+
+	transport.setValidationPolicy(Policy::OFF);
+	EXPECT_NO_THROW(static_cast<void>(transport.send(malformed)));
+	EXPECT_NO_THROW(static_cast<void>(transport.send(expired)));
+
+	// Per-call override
+	EXPECT_THROW(static_cast<void>(transport.send(malformed, Policy::ALWAYS)),
+	             InvalidUMessage);
+
+	auto stats = transport.getValidationStats();
+	EXPECT_EQ(stats.validated, 3);
+	EXPECT_EQ(stats.skipped, 4);
+	EXPECT_EQ(stats.rejected, 4);
+	EXPECT_EQ(transport.send_count_, 3);
+
+	// Exactly one message in each interval is checked
+	transport.setValidationPolicy(Policy::SAMPLED, 4);
+	int rejected = 0;
+	for (int i = 0; i < 12; ++i) {
+		try {
+			static_cast<void>(transport.send(malformed));
+		} catch (const InvalidUMessage&) {
+			++rejected;
+		}
+	}
+	EXPECT_EQ(rejected, 3);
+	stats = transport.getValidationStats();
+	EXPECT_EQ(stats.validated, 6);
+	EXPECT_EQ(stats.skipped, 13);
+}
+
+/// @brief Transport that sends whole batches at once
+class BatchingTransport : public uprotocol::test::UTransportMock {
+public:
+	using UTransportMock::UTransportMock;
+
+	std::vector<size_t> batch_sizes_;
+
+private:
+	[[nodiscard]] std::vector<uprotocol::v1::UStatus> sendBatchImpl(
+	    const uprotocol::v1::UMessage* /* messages */,
+	    size_t count) override {
+		batch_sizes_.push_back(count);
+		std::vector<uprotocol::v1::UStatus> statuses(count);
+		if (!statuses.empty()) {
+			statuses.back().set_code(uprotocol::v1::UCode::UNAVAILABLE);
+		}
+		return statuses;
+	}
+};
+
+TEST_F(TestMockUTransport, SendBatch) {
+	using uprotocol::datamodel::validator::message::InvalidUMessage;
+
+	uprotocol::v1::UUri def_src_uuri;
+	def_src_uuri.set_authority_name(get_random_string());
+	def_src_uuri.set_ue_id(0x18000);
+	def_src_uuri.set_ue_version_major(1);
+	def_src_uuri.set_resource_id(0);
+
+	std::vector<uprotocol::v1::UMessage> messages;
+	for (int i = 0; i < 3; ++i) {
+		messages.push_back(make_publish_message());
+		messages.back().set_payload(std::to_string(i));
+	}
+
+	// Default implementation sends one message at a time
+	uprotocol::test::UTransportMock transport(def_src_uuri);
+	transport.send_status_.set_code(uprotocol::v1::UCode::OK);
+	auto statuses = transport.sendBatch(messages);
+	ASSERT_EQ(statuses.size(), 3);
+	for (const auto& status : statuses) {
+		EXPECT_EQ(status.code(), uprotocol::v1::UCode::OK);
+	}
+	EXPECT_EQ(transport.send_count_, 3);
+	EXPECT_EQ(transport.message_.payload(), "2");
+	EXPECT_TRUE(transport.sendBatch(nullptr, 0).empty());
+
+	// Nothing is sent if any message is invalid
+	auto invalid = messages;
+	*invalid[1].mutable_attributes()->mutable_sink() = def_src_uuri;
+	EXPECT_THROW(static_cast<void>(transport.sendBatch(invalid)),
+	             InvalidUMessage);
+	EXPECT_EQ(transport.send_count_, 3);
+	EXPECT_EQ(transport.getValidationStats().rejected, 1);
+
+	// Implementations can take the whole batch in one call
+	BatchingTransport batching(def_src_uuri);
+	statuses = batching.sendBatch(messages.data(), 2);
+	ASSERT_EQ(statuses.size(), 2);
+	EXPECT_EQ(statuses[0].code(), uprotocol::v1::UCode::OK);
+	EXPECT_EQ(statuses[1].code(), uprotocol::v1::UCode::UNAVAILABLE);
+	EXPECT_EQ(batching.batch_sizes_, std::vector<size_t>{2});
+	EXPECT_EQ(batching.send_count_, 0);
+}
+
 }  // namespace
@@ -11,10 +11,24 @@
 
 #include <gtest/gtest.h>
 #include <up-cpp/utils/CyclicQueue.h>
+#include <up-cpp/utils/LockFreeCyclicQueue.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
 
 namespace {
 
-class TestFixture : public testing::Test {
+using namespace std::chrono_literals;
+using uprotocol::utils::CyclicQueue;
+using uprotocol::utils::LockFreeCyclicQueue;
+
+// Both queue implementations must behave identically, so every test here is
+// run against each of them.
+template <typename Queue>
+class TestCyclicQueue : public testing::Test {
 protected:
 	// Run once per TEST_F.
 	// Used to set up clean environments per test.
@@ -23,8 +37,8 @@ protected:
 
 	// Run once per execution of the test application.
 	// Used for setup of all tests. Has access to this instance.
-	TestFixture() = default;
-	~TestFixture() = default;
+	TestCyclicQueue() = default;
+	~TestCyclicQueue() = default;
 
 	// Run once per execution of the test application.
 	// Used only for global setup outside of tests.
@@ -32,7 +46,240 @@ protected:
 	static void TearDownTestSuite() {}
 };
 
-// TODO replace
-TEST_F(TestFixture, SomeTestName) {}
+using QueueTypes =
+    testing::Types<CyclicQueue<int>, LockFreeCyclicQueue<int>>;
+TYPED_TEST_SUITE(TestCyclicQueue, QueueTypes);
+
+TYPED_TEST(TestCyclicQueue, StartsEmpty) {
+	TypeParam queue(4);
+	EXPECT_TRUE(queue.isEmpty());
+	EXPECT_FALSE(queue.isFull());
+	EXPECT_EQ(queue.size(), 0);
+
+	int value = -1;
+	EXPECT_FALSE(queue.tryPop(value));
+	EXPECT_EQ(value, -1);
+}
+
+TYPED_TEST(TestCyclicQueue, PopsInFifoOrder) {
+	TypeParam queue(4);
+	const int first = 1;
+	queue.push(first);
+	queue.push(2);
+	queue.push(3);
+	EXPECT_EQ(queue.size(), 3);
+
+	int value = 0;
+	for (int expected = 1; expected <= 3; ++expected) {
+		ASSERT_TRUE(queue.tryPop(value));
+		EXPECT_EQ(value, expected);
+	}
+	EXPECT_TRUE(queue.isEmpty());
+}
+
+TYPED_TEST(TestCyclicQueue, FullQueueEvictsOldest) {
+	TypeParam queue(3);
+	for (int i = 0; i < 5; ++i) {
+		queue.push(i);
+	}
+	EXPECT_TRUE(queue.isFull());
+	EXPECT_EQ(queue.size(), 3);
+
+	int value = 0;
+	for (int expected = 2; expected < 5; ++expected) {
+		ASSERT_TRUE(queue.tryPop(value));
+		EXPECT_EQ(value, expected);
+	}
+	EXPECT_FALSE(queue.tryPop(value));
+}
+
+TYPED_TEST(TestCyclicQueue, SingleEntryQueueEvicts) {
+	TypeParam queue(1);
+	queue.push(1);
+	queue.push(2);
+	EXPECT_EQ(queue.size(), 1);
+
+	int value = 0;
+	ASSERT_TRUE(queue.tryPop(value));
+	EXPECT_EQ(value, 2);
+	EXPECT_FALSE(queue.tryPop(value));
+
+	queue.push(3);
+	ASSERT_TRUE(queue.tryPop(value));
+	EXPECT_EQ(value, 3);
+}
+
+TYPED_TEST(TestCyclicQueue, WrapsAroundRepeatedly) {
+	TypeParam queue(3);
+	int value = 0;
+	for (int i = 0; i < 100; ++i) {
+		queue.push(i);
+		ASSERT_TRUE(queue.tryPop(value));
+		EXPECT_EQ(value, i);
+	}
+	EXPECT_TRUE(queue.isEmpty());
+}
+
+TYPED_TEST(TestCyclicQueue, ClearEmptiesQueue) {
+	TypeParam queue(4);
+	queue.push(1);
+	queue.push(2);
+	queue.clear();
+	EXPECT_TRUE(queue.isEmpty());
+
+	queue.push(3);
+	int value = 0;
+	ASSERT_TRUE(queue.tryPop(value));
+	EXPECT_EQ(value, 3);
+}
+
+TYPED_TEST(TestCyclicQueue, TimedPopTimesOut) {
+	TypeParam queue(4);
+	int value = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	EXPECT_FALSE(queue.tryPopFor(value, 20ms));
+	EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+	EXPECT_FALSE(
+	    queue.tryPopUntil(value, std::chrono::system_clock::now() + 10ms));
+}
+
+TYPED_TEST(TestCyclicQueue, BlockingPopWakesOnPush) {
+	TypeParam queue(4);
+	std::thread producer([&queue]() {
+		std::this_thread::sleep_for(20ms);
+		queue.push(42);
+	});
+
+	int value = 0;
+	EXPECT_TRUE(queue.pop(value));
+	EXPECT_EQ(value, 42);
+	producer.join();
+
+	std::thread late_producer([&queue]() {
+		std::this_thread::sleep_for(20ms);
+		queue.push(43);
+	});
+	EXPECT_TRUE(queue.tryPopFor(value, 2s));
+	EXPECT_EQ(value, 43);
+	late_producer.join();
+}
+
+TYPED_TEST(TestCyclicQueue, ConcurrentProducersAndConsumers) {
+	constexpr int num_producers = 4;
+	constexpr int num_consumers = 4;
+	constexpr int per_producer = 10000;
+	// Large enough that nothing is evicted, so every value must arrive
+	TypeParam queue(num_producers * per_producer);
+
+	std::vector<std::vector<int>> consumed(num_consumers);
+	std::vector<std::thread> threads;
+	for (int c = 0; c < num_consumers; ++c) {
+		threads.emplace_back([&queue, &consumed, c]() {
+			int value = 0;
+			while (queue.tryPopFor(value, 200ms)) {
+				consumed[c].push_back(value);
+			}
+		});
+	}
+	for (int p = 0; p < num_producers; ++p) {
+		threads.emplace_back([&queue, p]() {
+			for (int i = 0; i < per_producer; ++i) {
+				queue.push(p * per_producer + i);
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	std::vector<int> all;
+	for (const auto& values : consumed) {
+		// Each consumer sees each producer's values in order
+		for (int p = 0; p < num_producers; ++p) {
+			int last = -1;
+			for (int v : values) {
+				if (v / per_producer == p) {
+					EXPECT_GT(v, last);
+					last = v;
+				}
+			}
+		}
+		all.insert(all.end(), values.begin(), values.end());
+	}
+	std::sort(all.begin(), all.end());
+	ASSERT_EQ(all.size(), num_producers * per_producer);
+	for (int i = 0; i < num_producers * per_producer; ++i) {
+		EXPECT_EQ(all[i], i);
+	}
+}
+
+TYPED_TEST(TestCyclicQueue, ConcurrentOverwriteKeepsBound) {
+	constexpr size_t max_size = 8;
+	TypeParam queue(max_size);
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < 4; ++p) {
+		producers.emplace_back([&queue]() {
+			for (int i = 0; i < 10000; ++i) {
+				queue.push(i);
+			}
+		});
+	}
+	for (auto& thread : producers) {
+		thread.join();
+	}
+
+	EXPECT_EQ(queue.size(), max_size);
+	size_t popped = 0;
+	int value = 0;
+	while (queue.tryPop(value)) {
+		++popped;
+	}
+	EXPECT_EQ(popped, max_size);
+}
+
+TEST(TestLockFreeCyclicQueue, DestroysRemainingEntries) {
+	auto tracker = std::make_shared<int>(0);
+	{
+		LockFreeCyclicQueue<std::shared_ptr<int>> queue(4);
+		queue.push(tracker);
+		queue.push(tracker);
+		EXPECT_EQ(tracker.use_count(), 3);
+	}
+	EXPECT_EQ(tracker.use_count(), 1);
+}
+
+TEST(TestLockFreeCyclicQueue, InterruptWakesBlockedConsumers) {
+	LockFreeCyclicQueue<int> queue(4);
+	std::vector<std::thread> consumers;
+	std::atomic<int> returned{0};
+	for (int i = 0; i < 2; ++i) {
+		consumers.emplace_back([&queue, &returned, i]() {
+			int value = 0;
+			const bool popped =
+			    (i == 0) ? queue.pop(value)
+			             : queue.tryPopFor(value, std::chrono::hours(1));
+			EXPECT_FALSE(popped);
+			++returned;
+		});
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	EXPECT_EQ(returned, 0);
+	queue.interrupt();
+	for (auto& consumer : consumers) {
+		consumer.join();
+	}
+	EXPECT_EQ(returned, 2);
+
+	// Entries are still delivered, but empty pops no longer block
+	queue.push(7);
+	int value = 0;
+	EXPECT_TRUE(queue.pop(value));
+	EXPECT_EQ(value, 7);
+	EXPECT_FALSE(queue.pop(value));
+}
 
 }  // namespace
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/Future.h>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+using namespace std::chrono_literals;
+using uprotocol::utils::Future;
+using uprotocol::utils::Promise;
+using uprotocol::utils::ThreadPool;
+
+class TestFuture : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestFuture() = default;
+	~TestFuture() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+};
+
+TEST_F(TestFuture, GetAfterSet) {
+	Promise<int> promise;
+	auto future = promise.getFuture();
+	EXPECT_TRUE(future.valid());
+	EXPECT_FALSE(future.isReady());
+
+	promise.setValue(42);
+	EXPECT_TRUE(future.isReady());
+	EXPECT_EQ(future.get(), 42);
+	EXPECT_FALSE(future.valid());
+	EXPECT_THROW(future.get(), std::future_error);
+}
+
+TEST_F(TestFuture, GetBlocksUntilSet) {
+	Promise<std::string> promise;
+	auto future = promise.getFuture();
+
+	std::thread setter([&promise]() {
+		std::this_thread::sleep_for(10ms);
+		promise.setValue("done");
+	});
+	EXPECT_EQ(future.get(), "done");
+	setter.join();
+}
+
+TEST_F(TestFuture, FutureRetrievedOnce) {
+	Promise<int> promise;
+	auto future = promise.getFuture();
+	EXPECT_THROW(static_cast<void>(promise.getFuture()), std::future_error);
+}
+
+TEST_F(TestFuture, SetOnce) {
+	Promise<int> promise;
+	auto copy = promise;
+	promise.setValue(1);
+	EXPECT_THROW(copy.setValue(2), std::future_error);
+}
+
+TEST_F(TestFuture, BrokenPromise) {
+	Future<int> future;
+	bool called = false;
+	{
+		Promise<int> promise;
+		future = promise.getFuture();
+		auto copy = promise;
+	}
+	EXPECT_TRUE(future.isReady());
+	EXPECT_THROW(future.get(), std::future_error);
+
+	{
+		Promise<int> promise;
+		promise.getFuture().then([&called](int) { called = true; });
+	}
+	EXPECT_FALSE(called);
+}
+
+TEST_F(TestFuture, ThenBeforeSetRunsOnSetter) {
+	Promise<int> promise;
+	std::thread::id ran_on;
+	int seen = 0;
+	promise.getFuture().then([&](int value) {
+		seen = value;
+		ran_on = std::this_thread::get_id();
+	});
+	EXPECT_EQ(seen, 0);
+
+	std::thread setter([&promise]() { promise.setValue(7); });
+	setter.join();
+	EXPECT_EQ(seen, 7);
+	EXPECT_NE(ran_on, std::this_thread::get_id());
+}
+
+TEST_F(TestFuture, ThenAfterSetRunsImmediately) {
+	Promise<int> promise;
+	promise.setValue(3);
+	int seen = 0;
+	promise.getFuture().then([&seen](int value) { seen = value; });
+	EXPECT_EQ(seen, 3);
+}
+
+TEST_F(TestFuture, ThenChains) {
+	Promise<int> promise;
+	auto future = promise.getFuture()
+	                  .then([](int value) { return value * 2; })
+	                  .then([](int value) { return std::to_string(value); });
+
+	promise.setValue(21);
+	EXPECT_EQ(future.get(), "42");
+}
+
+TEST_F(TestFuture, BrokenPromiseBreaksChain) {
+	Future<int> future;
+	{
+		Promise<int> promise;
+		future = promise.getFuture().then([](int value) { return value; });
+	}
+	EXPECT_THROW(future.get(), std::future_error);
+}
+
+TEST_F(TestFuture, ThenOnExecutor) {
+	ThreadPool pool(16, 1, 1000ms);
+	Promise<std::unique_ptr<int>> promise;
+	auto future = promise.getFuture().then(pool, [](std::unique_ptr<int> v) {
+		return std::make_pair(*v, std::this_thread::get_id());
+	});
+
+	promise.setValue(std::make_unique<int>(5));
+	auto [value, ran_on] = future.get();
+	EXPECT_EQ(value, 5);
+	EXPECT_NE(ran_on, std::this_thread::get_id());
+}
+
+// A task evicted from a full pool still calls fn and completes the chain
+TEST_F(TestFuture, ThenOnExecutorRunsWhenDiscarded) {
+	ThreadPool pool(1, 1, 1000ms);
+	std::promise<void> started;
+	std::promise<void> release;
+	auto blocker = pool.submit([&started, released = release.get_future()]() {
+		started.set_value();
+		released.wait();
+	});
+	started.get_future().wait();
+
+	Promise<int> promise;
+	auto future = promise.getFuture().then(pool, [](int value) {
+		return std::make_pair(value, std::this_thread::get_id());
+	});
+	promise.setValue(7);
+	// Evicts the queued continuation
+	static_cast<void>(pool.submit([]() {}));
+	const bool ready = future.isReady();
+
+	release.set_value();
+	blocker.wait();
+	ASSERT_TRUE(ready);
+	auto [value, ran_on] = future.get();
+	EXPECT_EQ(value, 7);
+	EXPECT_EQ(ran_on, std::this_thread::get_id());
+}
+
+TEST_F(TestFuture, ConcurrentSetAndThen) {
+	// Races publishing the value against publishing the continuation
+	for (int i = 0; i < 2000; ++i) {
+		Promise<int> promise;
+		auto future = promise.getFuture();
+		std::atomic<int> seen{0};
+
+		std::thread setter([&promise, i]() { promise.setValue(int(i)); });
+		future.then([&seen](int value) { seen = value + 1; });
+		setter.join();
+		EXPECT_EQ(seen.load(), i + 1);
+	}
+}
+
+TEST_F(TestFuture, RecycledStatesStartClean) {
+	// Futures dropped in every state before being recycled
+	for (int i = 0; i < 3000; ++i) {
+		Promise<std::string> promise;
+		auto future = promise.getFuture();
+		switch (i % 3) {
+			case 0:
+				promise.setValue(std::to_string(i));
+				break;
+			case 1:
+				future.then([](const std::string&) {});
+				break;
+			default:
+				break;
+		}
+	}
+
+	for (int i = 0; i < 3000; ++i) {
+		Promise<std::string> promise;
+		auto future = promise.getFuture();
+		ASSERT_FALSE(future.isReady());
+		promise.setValue(std::to_string(i));
+		ASSERT_EQ(future.get(), std::to_string(i));
+	}
+}
+
+}  // namespace
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/LatencyHistogram.h>
+
+#include <thread>
+#include <vector>
+
+namespace {
+using namespace std::chrono_literals;
+using uprotocol::utils::LatencyHistogram;
+
+class TestLatencyHistogram : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestLatencyHistogram() = default;
+	~TestLatencyHistogram() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+};
+
+TEST_F(TestLatencyHistogram, BucketBoundaries) {
+	EXPECT_EQ(LatencyHistogram::bucketOf(-5ns), 0);
+	EXPECT_EQ(LatencyHistogram::bucketOf(999ns), 0);
+	EXPECT_EQ(LatencyHistogram::bucketOf(1us), 1);
+	EXPECT_EQ(LatencyHistogram::bucketOf(1999ns), 1);
+	EXPECT_EQ(LatencyHistogram::bucketOf(2us), 2);
+	EXPECT_EQ(LatencyHistogram::bucketOf(1ms), 10);
+	EXPECT_EQ(LatencyHistogram::bucketOf(24h),
+	          LatencyHistogram::NUM_BUCKETS - 1);
+
+	for (size_t bucket = 0; bucket < LatencyHistogram::NUM_BUCKETS - 1;
+	     ++bucket) {
+		const auto bound = LatencyHistogram::Snapshot::upperBound(bucket);
+		EXPECT_EQ(LatencyHistogram::bucketOf(bound - 1ns), bucket);
+		EXPECT_EQ(LatencyHistogram::bucketOf(bound), bucket + 1);
+	}
+}
+
+TEST_F(TestLatencyHistogram, RecordAndSnapshot) {
+	LatencyHistogram histogram;
+	auto empty = histogram.snapshot();
+	EXPECT_EQ(empty.count, 0);
+	EXPECT_EQ(empty.mean(), 0ns);
+	EXPECT_EQ(empty.percentile(0.5), 0ns);
+
+	histogram.record(500ns);
+	histogram.record(3us);
+	histogram.record(3500ns);
+	histogram.record(-1us);
+
+	const auto snapshot = histogram.snapshot();
+	EXPECT_EQ(snapshot.count, 4);
+	EXPECT_EQ(snapshot.buckets[0], 2);
+	EXPECT_EQ(snapshot.buckets[2], 2);
+	EXPECT_EQ(snapshot.total, 7us);
+	EXPECT_EQ(snapshot.max, 3500ns);
+	EXPECT_EQ(snapshot.mean(), 1750ns);
+}
+
+TEST_F(TestLatencyHistogram, Percentiles) {
+	LatencyHistogram histogram;
+	for (int i = 0; i < 90; ++i) {
+		histogram.record(10us);
+	}
+	for (int i = 0; i < 10; ++i) {
+		histogram.record(5ms);
+	}
+
+	const auto snapshot = histogram.snapshot();
+	// 10us is in [8, 16) us
+	EXPECT_EQ(snapshot.percentile(0.0), 16us);
+	EXPECT_EQ(snapshot.percentile(0.5), 16us);
+	EXPECT_EQ(snapshot.percentile(0.9), 16us);
+	// Capped at the largest duration recorded
+	EXPECT_EQ(snapshot.percentile(0.91), 5ms);
+	EXPECT_EQ(snapshot.percentile(1.0), 5ms);
+	EXPECT_EQ(snapshot.percentile(2.0), 5ms);
+}
+
+TEST_F(TestLatencyHistogram, ConcurrentRecord) {
+	constexpr int THREADS = 4;
+	constexpr int RECORDS = 10000;
+	LatencyHistogram histogram;
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < THREADS; ++t) {
+		threads.emplace_back([&histogram, t]() {
+			for (int i = 0; i < RECORDS; ++i) {
+				histogram.record(std::chrono::microseconds(t + 1));
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	const auto snapshot = histogram.snapshot();
+	EXPECT_EQ(snapshot.count, THREADS * RECORDS);
+	EXPECT_EQ(snapshot.total, std::chrono::microseconds(RECORDS * 10));
+	EXPECT_EQ(snapshot.max, std::chrono::microseconds(THREADS));
+}
+
+}  // namespace
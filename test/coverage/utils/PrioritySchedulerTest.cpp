@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/PriorityScheduler.h>
+
+#include <algorithm>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace {
+using namespace uprotocol::v1;
+using namespace std::chrono_literals;
+using Scheduler = uprotocol::utils::PriorityScheduler<int>;
+
+class TestPriorityScheduler : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestPriorityScheduler() = default;
+	~TestPriorityScheduler() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static std::vector<int> popAll(Scheduler& scheduler) {
+		std::vector<int> items;
+		int item;
+		while (scheduler.pop(item)) {
+			items.push_back(item);
+		}
+		return items;
+	}
+};
+
+TEST_F(TestPriorityScheduler, StrictPriorityOrder) {
+	Scheduler scheduler;
+	int item;
+	EXPECT_FALSE(scheduler.pop(item));
+
+	scheduler.push(UPRIORITY_CS0, 1);
+	scheduler.push(UPRIORITY_CS6, 2);
+	scheduler.push(UPRIORITY_CS0, 3);
+	scheduler.push(UPRIORITY_CS3, 4);
+	scheduler.push(UPRIORITY_CS6, 5);
+	EXPECT_EQ(scheduler.size(), 5);
+
+	EXPECT_EQ(popAll(scheduler), (std::vector<int>{2, 5, 4, 1, 3}));
+	EXPECT_TRUE(scheduler.empty());
+}
+
+TEST_F(TestPriorityScheduler, UnspecifiedIsCS1) {
+	EXPECT_EQ(Scheduler::classOf(UPRIORITY_UNSPECIFIED), UPRIORITY_CS1);
+	EXPECT_EQ(Scheduler::classOf(static_cast<UPriority>(100)), UPRIORITY_CS1);
+	EXPECT_EQ(Scheduler::classOf(UPRIORITY_CS5), UPRIORITY_CS5);
+
+	Scheduler scheduler;
+	scheduler.push(UPRIORITY_CS0, 1);
+	scheduler.push(UPRIORITY_UNSPECIFIED, 2);
+	scheduler.push(UPRIORITY_CS1, 3);
+	EXPECT_EQ(popAll(scheduler), (std::vector<int>{2, 3, 1}));
+}
+
+TEST_F(TestPriorityScheduler, WeightedFairShares) {
+	Scheduler::Weights weights{1, 1, 1, 1, 1, 1, 1, 3};
+	Scheduler scheduler(Scheduler::Policy::WEIGHTED_FAIR, weights);
+
+	for (int i = 0; i < 40; ++i) {
+		scheduler.push(UPRIORITY_CS0, 0);
+		scheduler.push(UPRIORITY_CS6, 6);
+	}
+
+	// CS6 gets three items for every one of CS0 while both are busy
+	std::map<int, int> counts;
+	int item;
+	for (int i = 0; i < 40; ++i) {
+		ASSERT_TRUE(scheduler.pop(item));
+		++counts[item];
+	}
+	EXPECT_EQ(counts[6], 30);
+	EXPECT_EQ(counts[0], 10);
+
+	// Work conserving: the remaining class drains without waiting
+	EXPECT_EQ(popAll(scheduler).size(), 40);
+}
+
+TEST_F(TestPriorityScheduler, WeightedFairNeverStarves) {
+	Scheduler scheduler(Scheduler::Policy::WEIGHTED_FAIR);
+	scheduler.push(UPRIORITY_CS0, 0);
+	for (int i = 0; i < 1000; ++i) {
+		scheduler.push(UPRIORITY_CS6, 6);
+	}
+
+	auto order = popAll(scheduler);
+	auto position = std::find(order.begin(), order.end(), 0) - order.begin();
+	// Within the first round of DEFAULT_WEIGHTS
+	EXPECT_LE(position, 127);
+}
+
+TEST_F(TestPriorityScheduler, DropOldestLowestClass) {
+	Scheduler scheduler;
+	scheduler.push(UPRIORITY_CS3, 1);
+	scheduler.push(UPRIORITY_CS0, 2);
+	scheduler.push(UPRIORITY_CS0, 3);
+
+	int item;
+	ASSERT_TRUE(scheduler.dropOldest(UPRIORITY_CS6, item));
+	EXPECT_EQ(item, 2);
+	ASSERT_TRUE(scheduler.dropOldest(UPRIORITY_CS0, item));
+	EXPECT_EQ(item, 3);
+	// Only CS3 is left, which is higher than CS2
+	EXPECT_FALSE(scheduler.dropOldest(UPRIORITY_CS2, item));
+	EXPECT_EQ(scheduler.size(), 1);
+	EXPECT_EQ(scheduler.stats(UPRIORITY_CS0).dropped, 2);
+}
+
+TEST_F(TestPriorityScheduler, TracksDepthAndWait) {
+	Scheduler scheduler;
+	scheduler.push(UPRIORITY_CS4, 1);
+	scheduler.push(UPRIORITY_CS4, 2);
+	scheduler.push(UPRIORITY_CS2, 3);
+
+	auto stats = scheduler.stats(UPRIORITY_CS4);
+	EXPECT_EQ(stats.depth, 2);
+	EXPECT_EQ(stats.dequeued, 0);
+
+	std::this_thread::sleep_for(5ms);
+	int item;
+	ASSERT_TRUE(scheduler.pop(item));
+
+	stats = scheduler.stats(UPRIORITY_CS4);
+	EXPECT_EQ(stats.depth, 1);
+	EXPECT_EQ(stats.dequeued, 1);
+	EXPECT_GE(stats.max_wait, 5ms);
+	EXPECT_EQ(stats.total_wait, stats.max_wait);
+	EXPECT_EQ(scheduler.stats(UPRIORITY_CS2).depth, 1);
+
+	std::vector<int> drained;
+	scheduler.drain([&drained](int&& i) { drained.push_back(i); });
+	EXPECT_EQ(drained, (std::vector<int>{2, 3}));
+	EXPECT_TRUE(scheduler.empty());
+	EXPECT_EQ(scheduler.stats(UPRIORITY_CS4).depth, 0);
+}
+
+}  // namespace
@@ -12,9 +12,19 @@
 #include <gtest/gtest.h>
 #include <up-cpp/utils/ThreadPool.h>
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
 namespace {
 
-class TestFixture : public testing::Test {
+using namespace std::chrono_literals;
+using uprotocol::utils::ThreadPool;
+
+class TestThreadPool : public testing::TestWithParam<ThreadPool::Scheduling> {
 protected:
 	// Run once per TEST_F.
 	// Used to set up clean environments per test.
@@ -23,16 +33,172 @@ protected:
 
 	// Run once per execution of the test application.
 	// Used for setup of all tests. Has access to this instance.
-	TestFixture() = default;
-	~TestFixture() = default;
+	TestThreadPool() = default;
+	~TestThreadPool() = default;
 
 	// Run once per execution of the test application.
 	// Used only for global setup outside of tests.
 	static void SetUpTestSuite() {}
 	static void TearDownTestSuite() {}
+
+	std::unique_ptr<ThreadPool> makePool(size_t max_queue_size,
+	                                     size_t max_threads) {
+		return std::make_unique<ThreadPool>(max_queue_size, max_threads,
+		                                    100ms, GetParam());
+	}
 };
 
-// TODO replace
-TEST_F(TestFixture, SomeTestName) {}
+TEST_P(TestThreadPool, RunsTaskAndReturnsResult) {
+	auto pool = makePool(16, 2);
+	auto future = pool->submit([](int a, int b) { return a + b; }, 2, 3);
+	ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(future.get(), 5);
+}
+
+TEST_P(TestThreadPool, PropagatesExceptions) {
+	auto pool = makePool(16, 2);
+	auto future = pool->submit([]() { throw std::runtime_error("oops"); });
+	ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST_P(TestThreadPool, RunsManyTasks) {
+	constexpr int num_tasks = 1000;
+	auto pool = makePool(num_tasks, 4);
+
+	std::atomic<int> sum{0};
+	std::vector<std::future<void>> futures;
+	for (int i = 1; i <= num_tasks; ++i) {
+		futures.push_back(pool->submit([&sum, i]() { sum += i; }));
+	}
+	for (auto& future : futures) {
+		ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	}
+	EXPECT_EQ(sum, num_tasks * (num_tasks + 1) / 2);
+}
+
+TEST_P(TestThreadPool, NeverExceedsMaxThreads) {
+	constexpr size_t max_threads = 3;
+	auto pool = makePool(100, max_threads);
+
+	std::atomic<size_t> running{0};
+	std::atomic<size_t> peak{0};
+	std::vector<std::future<void>> futures;
+	for (int i = 0; i < 30; ++i) {
+		futures.push_back(pool->submit([&running, &peak]() {
+			size_t now = ++running;
+			size_t prev = peak.load();
+			while (now > prev && !peak.compare_exchange_weak(prev, now)) {
+			}
+			std::this_thread::sleep_for(2ms);
+			--running;
+		}));
+	}
+	for (auto& future : futures) {
+		ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	}
+	EXPECT_LE(peak, max_threads);
+	EXPECT_GE(peak, 1);
+}
+
+TEST_P(TestThreadPool, TasksCanSubmitTasks) {
+	auto pool = makePool(100, 2);
+
+	std::atomic<int> count{0};
+	auto outer = pool->submit([&pool, &count]() {
+		std::vector<std::future<void>> inner;
+		for (int i = 0; i < 10; ++i) {
+			inner.push_back(pool->submit([&count]() { ++count; }));
+		}
+		return inner;
+	});
+	ASSERT_EQ(outer.wait_for(2s), std::future_status::ready);
+	for (auto& future : outer.get()) {
+		ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	}
+	EXPECT_EQ(count, 10);
+}
+
+TEST_P(TestThreadPool, RestartsAfterIdle) {
+	auto pool = makePool(16, 2);
+	auto first = pool->submit([]() { return 1; });
+	ASSERT_EQ(first.wait_for(2s), std::future_status::ready);
+
+	// Long enough for SHARED_QUEUE workers to time out and exit
+	std::this_thread::sleep_for(250ms);
+
+	auto second = pool->submit([]() { return 2; });
+	ASSERT_EQ(second.wait_for(2s), std::future_status::ready);
+	EXPECT_EQ(second.get(), 2);
+}
+
+TEST_P(TestThreadPool, ShutdownWakesIdleWorkers) {
+	// Idle timeout far longer than the test is allowed to take
+	auto pool = std::make_unique<ThreadPool>(2, 2, 1h, GetParam());
+	auto first = pool->submit([]() { return 1; });
+	ASSERT_EQ(first.wait_for(2s), std::future_status::ready);
+
+	const auto start = std::chrono::steady_clock::now();
+	pool.reset();
+	EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Scheduling, TestThreadPool,
+    testing::Values(ThreadPool::Scheduling::SHARED_QUEUE,
+                    ThreadPool::Scheduling::WORK_STEALING),
+    [](const testing::TestParamInfo<ThreadPool::Scheduling>& info) {
+	    return info.param == ThreadPool::Scheduling::SHARED_QUEUE
+	               ? "SharedQueue"
+	               : "WorkStealing";
+    });
+
+TEST(TestWorkStealingThreadPool, IdleWorkersStealLocalTasks) {
+	constexpr size_t num_workers = 4;
+	ThreadPool pool(100, num_workers, 100ms,
+	                ThreadPool::Scheduling::WORK_STEALING);
+
+	std::mutex mtx;
+	std::set<std::thread::id> ran_on;
+
+	// All of these land on a single worker's deque. They can only run on
+	// other threads if they are stolen.
+	auto spawner = pool.submit([&pool, &mtx, &ran_on]() {
+		std::vector<std::future<void>> tasks;
+		for (int i = 0; i < 40; ++i) {
+			tasks.push_back(pool.submit([&mtx, &ran_on]() {
+				std::this_thread::sleep_for(5ms);
+				std::lock_guard lock(mtx);
+				ran_on.insert(std::this_thread::get_id());
+			}));
+		}
+		return tasks;
+	});
+	ASSERT_EQ(spawner.wait_for(2s), std::future_status::ready);
+	for (auto& future : spawner.get()) {
+		ASSERT_EQ(future.wait_for(2s), std::future_status::ready);
+	}
+
+	EXPECT_GT(ran_on.size(), 1);
+}
+
+TEST(TestWorkStealingThreadPool, FullLocalQueueDiscardsOldest) {
+	ThreadPool pool(2, 1, 100ms, ThreadPool::Scheduling::WORK_STEALING);
+
+	auto spawner = pool.submit([&pool]() {
+		std::vector<std::future<int>> tasks;
+		for (int i = 0; i < 4; ++i) {
+			tasks.push_back(pool.submit([i]() { return i; }));
+		}
+		return tasks;
+	});
+	ASSERT_EQ(spawner.wait_for(2s), std::future_status::ready);
+
+	auto tasks = spawner.get();
+	EXPECT_THROW(tasks[0].get(), std::future_error);
+	EXPECT_THROW(tasks[1].get(), std::future_error);
+	EXPECT_EQ(tasks[2].get(), 2);
+	EXPECT_EQ(tasks[3].get(), 3);
+}
 
 }  // namespace
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/TimerWheel.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+using Wheel = uprotocol::utils::TimerWheel<int>;
+
+class TestTimerWheel : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestTimerWheel() = default;
+	~TestTimerWheel() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static std::vector<int> advance(Wheel& wheel, Wheel::Tick now) {
+		std::vector<int> expired;
+		wheel.advance(now,
+		              [&expired](int&& value) { expired.push_back(value); });
+		return expired;
+	}
+};
+
+TEST_F(TestTimerWheel, ExpiresInDelayOrder) {
+	Wheel wheel;
+	wheel.schedule(3, 3);
+	wheel.schedule(1, 1);
+	wheel.schedule(2, 2);
+	EXPECT_EQ(wheel.size(), 3);
+
+	EXPECT_TRUE(advance(wheel, 0).empty());
+	EXPECT_EQ(advance(wheel, 1), std::vector<int>({1}));
+	EXPECT_EQ(advance(wheel, 3), std::vector<int>({2, 3}));
+	EXPECT_TRUE(wheel.empty());
+	EXPECT_EQ(wheel.now(), 3);
+}
+
+TEST_F(TestTimerWheel, ZeroDelayExpiresOnNextAdvance) {
+	Wheel wheel(100);
+	wheel.schedule(0, 7);
+
+	EXPECT_EQ(advance(wheel, 100), std::vector<int>({7}));
+	EXPECT_TRUE(wheel.empty());
+}
+
+TEST_F(TestTimerWheel, DoesNotMoveBackwards) {
+	Wheel wheel(50);
+	wheel.schedule(10, 1);
+
+	EXPECT_TRUE(advance(wheel, 20).empty());
+	EXPECT_EQ(wheel.now(), 50);
+	EXPECT_EQ(advance(wheel, 60), std::vector<int>({1}));
+}
+
+TEST_F(TestTimerWheel, CascadesFromHigherLevels) {
+	Wheel wheel;
+	// One delay landing in each level, plus one on a level boundary
+	const std::vector<Wheel::Tick> delays{
+	    5, Wheel::SLOTS, Wheel::SLOTS + 3, Wheel::SLOTS * Wheel::SLOTS + 1,
+	    Wheel::SLOTS * Wheel::SLOTS * Wheel::SLOTS + 9};
+	for (size_t i = 0; i < delays.size(); ++i) {
+		wheel.schedule(delays[i], static_cast<int>(i));
+	}
+
+	for (size_t i = 0; i < delays.size(); ++i) {
+		EXPECT_TRUE(advance(wheel, delays[i] - 1).empty()) << "delay " << i;
+		EXPECT_EQ(advance(wheel, delays[i]),
+		          std::vector<int>({static_cast<int>(i)}));
+	}
+	EXPECT_TRUE(wheel.empty());
+}
+
+TEST_F(TestTimerWheel, FastForwardsWhenEmpty) {
+	Wheel wheel;
+	EXPECT_TRUE(advance(wheel, 1000000).empty());
+	EXPECT_EQ(wheel.now(), 1000000);
+
+	wheel.schedule(10, 1);
+	EXPECT_EQ(advance(wheel, 1000010), std::vector<int>({1}));
+}
+
+// Advancing jumps between occupied slots, so this takes a handful of steps
+// rather than one per tick
+TEST_F(TestTimerWheel, ClampsToMaxDelay) {
+	for (const Wheel::Tick start : {Wheel::Tick{0}, Wheel::Tick{12345},
+	                                Wheel::MAX_DELAY - 5}) {
+		Wheel wheel(start);
+		wheel.schedule(Wheel::MAX_DELAY + 1000, 1);
+
+		EXPECT_TRUE(advance(wheel, start + Wheel::MAX_DELAY - 1).empty())
+		    << "start " << start;
+		EXPECT_EQ(advance(wheel, start + Wheel::MAX_DELAY),
+		          std::vector<int>({1}))
+		    << "start " << start;
+	}
+}
+
+TEST_F(TestTimerWheel, NextEvent) {
+	Wheel wheel(10);
+	EXPECT_FALSE(wheel.nextEvent());
+
+	wheel.schedule(5, 1);
+	EXPECT_EQ(wheel.nextEvent(), 15);
+
+	// Cascades come before the expiry they lead to
+	wheel.schedule(Wheel::SLOTS * 3, 2);
+	EXPECT_EQ(wheel.nextEvent(), 15);
+	EXPECT_EQ(advance(wheel, 15), std::vector<int>({1}));
+	EXPECT_EQ(wheel.nextEvent(), Wheel::SLOTS * 3);
+	EXPECT_TRUE(advance(wheel, Wheel::SLOTS * 3).empty());
+	EXPECT_EQ(wheel.nextEvent(), 10 + Wheel::SLOTS * 3);
+
+	wheel.schedule(0, 3);
+	EXPECT_EQ(wheel.nextEvent(), wheel.now());
+}
+
+TEST_F(TestTimerWheel, ScheduledWhileRunningExpireOnTime) {
+	std::mt19937 random(1234);
+	std::uniform_int_distribution<Wheel::Tick> delay(0, 70000);
+
+	Wheel wheel;
+	std::map<int, Wheel::Tick> expected;
+	auto on_expire = [&expected, &wheel](int&& value) {
+		// Neither early nor late
+		EXPECT_EQ(expected.at(value), wheel.now());
+		expected.erase(value);
+	};
+
+	int next = 0;
+	for (Wheel::Tick now = 0; now < 200000; now += 97) {
+		for (int i = 0; i < 4; ++i) {
+			const auto d = delay(random);
+			expected[next] = wheel.now() + d;
+			wheel.schedule(d, int(next++));
+		}
+		wheel.advance(now, on_expire);
+	}
+	wheel.advance(300000, on_expire);
+	EXPECT_TRUE(expected.empty());
+	EXPECT_TRUE(wheel.empty());
+}
+
+}  // namespace
@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/datamodel/validator/UUri.h>
+#include <up-cpp/utils/UUriKey.h>
+#include <up-cpp/utils/UUriMatcher.h>
+
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+using uprotocol::utils::AuthorityTable;
+using uprotocol::utils::UUriKey;
+
+class TestUUriKey : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestUUriKey() = default;
+	~TestUUriKey() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static uprotocol::v1::UUri makeUri(const std::string& authority,
+	                                   uint32_t ue_id, uint32_t version,
+	                                   uint32_t resource_id) {
+		uprotocol::v1::UUri uri;
+		uri.set_authority_name(authority);
+		uri.set_ue_id(ue_id);
+		uri.set_ue_version_major(version);
+		uri.set_resource_id(resource_id);
+		return uri;
+	}
+
+	AuthorityTable table_;
+};
+
+TEST_F(TestUUriKey, TableReservesLocalAndWildcard) {
+	EXPECT_EQ(table_.intern(""), AuthorityTable::LOCAL);
+	EXPECT_EQ(table_.intern("*"), AuthorityTable::WILDCARD);
+	EXPECT_EQ(table_.name(AuthorityTable::LOCAL), "");
+	EXPECT_EQ(table_.name(AuthorityTable::WILDCARD), "*");
+	EXPECT_EQ(table_.size(), 2);
+}
+
+TEST_F(TestUUriKey, TableInternIsStable) {
+	auto first = table_.intern("host1");
+	auto second = table_.intern("host2");
+	EXPECT_NE(first, second);
+	EXPECT_EQ(table_.intern(std::string("host1")), first);
+	EXPECT_EQ(table_.name(first), "host1");
+	EXPECT_EQ(table_.name(second), "host2");
+	EXPECT_EQ(table_.size(), 4);
+	EXPECT_THROW(static_cast<void>(table_.name(100)), std::out_of_range);
+}
+
+TEST_F(TestUUriKey, TableFindDoesNotIntern) {
+	EXPECT_EQ(table_.find(""), AuthorityTable::LOCAL);
+	EXPECT_EQ(table_.find("*"), AuthorityTable::WILDCARD);
+	EXPECT_FALSE(table_.find("host"));
+	EXPECT_EQ(table_.size(), 2);
+
+	const auto id = table_.intern("host");
+	EXPECT_EQ(table_.find("host"), id);
+	EXPECT_EQ(table_.size(), 3);
+}
+
+TEST_F(TestUUriKey, TableConcurrentInternAgrees) {
+	constexpr int num_threads = 8;
+	constexpr int num_names = 100;
+	std::vector<std::vector<AuthorityTable::Id>> ids(num_threads);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < num_threads; ++t) {
+		threads.emplace_back([this, &ids, t]() {
+			for (int i = 0; i < num_names; ++i) {
+				ids[t].push_back(table_.intern("host" + std::to_string(i)));
+			}
+		});
+	}
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	for (int t = 1; t < num_threads; ++t) {
+		EXPECT_EQ(ids[t], ids[0]);
+	}
+	EXPECT_EQ(table_.size(), num_names + 2);
+}
+
+TEST_F(TestUUriKey, EqualUrisMakeEqualKeys) {
+	UUriKey a(makeUri("host", 0x00020001, 1, 0x8001), table_);
+	UUriKey b(makeUri("host", 0x00020001, 1, 0x8001), table_);
+	EXPECT_EQ(a, b);
+	EXPECT_EQ(a.hash(), b.hash());
+	EXPECT_EQ(std::hash<UUriKey>{}(a), a.hash());
+
+	EXPECT_NE(a, UUriKey(makeUri("other", 0x00020001, 1, 0x8001), table_));
+	EXPECT_NE(a, UUriKey(makeUri("host", 0x00030001, 1, 0x8001), table_));
+	EXPECT_NE(a, UUriKey(makeUri("host", 0x00020001, 2, 0x8001), table_));
+	EXPECT_NE(a, UUriKey(makeUri("host", 0x00020001, 1, 0x8002), table_));
+}
+
+TEST_F(TestUUriKey, KeysWorkInUnorderedSet) {
+	std::unordered_set<UUriKey, UUriKey::Hash> keys;
+	for (uint32_t resource = 1; resource <= 100; ++resource) {
+		keys.emplace(makeUri("host", 0x00020001, 1, resource), table_);
+		keys.emplace(makeUri("host", 0x00020001, 1, resource), table_);
+	}
+	EXPECT_EQ(keys.size(), 100);
+	EXPECT_EQ(keys.count(UUriKey(makeUri("host", 0x00020001, 1, 50), table_)),
+	          1);
+}
+
+TEST_F(TestUUriKey, RoundTripsToUUri) {
+	auto uri = makeUri("host", 0x00020001, 1, 0x8001);
+	UUriKey key(uri, table_);
+	EXPECT_EQ(key.authority(), table_.intern("host"));
+	EXPECT_EQ(key.ueId(), 0x00020001);
+	EXPECT_EQ(key.version(), 1);
+	EXPECT_EQ(key.resourceId(), 0x8001);
+	EXPECT_EQ(key.toUUri(table_).SerializeAsString(), uri.SerializeAsString());
+}
+
+TEST_F(TestUUriKey, OutOfRangeFieldsThrow) {
+	EXPECT_THROW(UUriKey(makeUri("host", 0x00020001, 0x100, 1), table_),
+	             std::invalid_argument);
+	EXPECT_THROW(UUriKey(makeUri("host", 0x00020001, 1, 0x10000), table_),
+	             std::invalid_argument);
+}
+
+TEST_F(TestUUriKey, UsesWildcardsAgreesWithValidator) {
+	using uprotocol::datamodel::validator::uri::uses_wildcards;
+	for (const auto& uri : {makeUri("host", 0x00020001, 1, 0x8001),
+	                        makeUri("*", 0x00020001, 1, 0x8001),
+	                        makeUri("ho*st", 0x00020001, 1, 0x8001),
+	                        makeUri("host", 0x0002FFFF, 1, 0x8001),
+	                        makeUri("host", 0x00000001, 1, 0x8001),
+	                        makeUri("host", 0x00020001, 0xFF, 0x8001),
+	                        makeUri("host", 0x00020001, 1, 0xFFFF)}) {
+		const UUriKey key(uri, table_);
+		EXPECT_EQ(key.usesWildcards(), uses_wildcards(uri))
+		    << uri.ShortDebugString();
+		EXPECT_EQ(uses_wildcards(key), uses_wildcards(uri))
+		    << uri.ShortDebugString();
+	}
+}
+
+TEST_F(TestUUriKey, MatchesAgreesWithUUriMatcher) {
+	const std::vector<uprotocol::v1::UUri> filters = {
+	    makeUri("host", 0x00020001, 1, 0x8001),
+	    makeUri("*", 0x00020001, 1, 0x8001),
+	    makeUri("host", 0x0002FFFF, 1, 0x8001),
+	    makeUri("host", 0x00000001, 1, 0x8001),
+	    makeUri("host", 0x00020001, 0xFF, 0x8001),
+	    makeUri("host", 0x00020001, 1, 0xFFFF),
+	    makeUri("*", 0xFFFF, 0xFF, 0xFFFF),
+	    makeUri("other", 0x00020001, 1, 0x8001),
+	    makeUri("host", 0x00030001, 1, 0x8001)};
+	const std::vector<uprotocol::v1::UUri> uris = {
+	    makeUri("host", 0x00020001, 1, 0x8001),
+	    makeUri("host", 0x00030001, 1, 0x8001),
+	    makeUri("host", 0x00020002, 2, 0x8002),
+	    makeUri("other", 0x00020001, 1, 0x8001)};
+
+	for (size_t f = 0; f < filters.size(); ++f) {
+		uprotocol::utils::UUriMatcher<size_t> matcher;
+		matcher.insert(filters[f], f);
+		UUriKey filter(filters[f], table_);
+		for (const auto& uri : uris) {
+			EXPECT_EQ(filter.matches(UUriKey(uri, table_)),
+			          !matcher.match(uri).empty())
+			    << filters[f].ShortDebugString() << " vs "
+			    << uri.ShortDebugString();
+		}
+	}
+}
+
+}  // namespace
@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/UUriMatcher.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+using uprotocol::utils::UUriMatcher;
+
+class TestUUriMatcher : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestUUriMatcher() = default;
+	~TestUUriMatcher() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static uprotocol::v1::UUri makeUri(const std::string& authority,
+	                                   uint32_t ue_id, uint32_t version,
+	                                   uint32_t resource_id) {
+		uprotocol::v1::UUri uri;
+		uri.set_authority_name(authority);
+		uri.set_ue_id(ue_id);
+		uri.set_ue_version_major(version);
+		uri.set_resource_id(resource_id);
+		return uri;
+	}
+
+	static std::vector<int> sorted(std::vector<int> values) {
+		std::sort(values.begin(), values.end());
+		return values;
+	}
+
+	const uprotocol::v1::UUri uri_ = makeUri("host", 0x00020001, 1, 0x8001);
+};
+
+TEST_F(TestUUriMatcher, EmptyMatcherMatchesNothing) {
+	UUriMatcher<int> matcher;
+	EXPECT_TRUE(matcher.empty());
+	EXPECT_EQ(matcher.size(), 0);
+	EXPECT_TRUE(matcher.match(uri_).empty());
+}
+
+TEST_F(TestUUriMatcher, ExactFilterMatches) {
+	UUriMatcher<int> matcher;
+	matcher.insert(uri_, 1);
+	matcher.insert(makeUri("host", 0x00020001, 1, 0x8002), 2);
+	matcher.insert(makeUri("other", 0x00020001, 1, 0x8001), 3);
+
+	EXPECT_EQ(matcher.size(), 3);
+	EXPECT_EQ(matcher.match(uri_), std::vector<int>{1});
+}
+
+TEST_F(TestUUriMatcher, EachWildcardFieldMatches) {
+	UUriMatcher<int> matcher;
+	matcher.insert(makeUri("*", 0x00020001, 1, 0x8001), 1);
+	matcher.insert(makeUri("host", 0x0002FFFF, 1, 0x8001), 2);
+	matcher.insert(makeUri("host", 0x00000001, 1, 0x8001), 3);
+	matcher.insert(makeUri("host", 0x0000FFFF, 1, 0x8001), 4);
+	matcher.insert(makeUri("host", 0x00020001, 0xFF, 0x8001), 5);
+	matcher.insert(makeUri("host", 0x00020001, 1, 0xFFFF), 6);
+	matcher.insert(makeUri("*", 0x0000FFFF, 0xFF, 0xFFFF), 7);
+
+	EXPECT_EQ(sorted(matcher.match(uri_)),
+	          (std::vector<int>{1, 2, 3, 4, 5, 6, 7}));
+}
+
+TEST_F(TestUUriMatcher, WildcardsDoNotOvermatch) {
+	UUriMatcher<int> matcher;
+	// Wildcard in one field, mismatch in another
+	matcher.insert(makeUri("*", 0x00020002, 1, 0x8001), 1);
+	matcher.insert(makeUri("host", 0x0003FFFF, 1, 0x8001), 2);
+	matcher.insert(makeUri("host", 0x00000002, 1, 0x8001), 3);
+	matcher.insert(makeUri("host", 0x00020001, 0xFF, 0x8002), 4);
+	matcher.insert(makeUri("host", 0x00020001, 2, 0xFFFF), 5);
+
+	EXPECT_TRUE(matcher.match(uri_).empty());
+}
+
+TEST_F(TestUUriMatcher, UnknownAuthorityMatchesOnlyWildcard) {
+	UUriMatcher<int> matcher;
+	matcher.insert(uri_, 1);
+	matcher.insert(makeUri("*", 0x00020001, 1, 0x8001), 2);
+
+	auto unknown = makeUri("unknown", 0x00020001, 1, 0x8001);
+	EXPECT_EQ(matcher.match(unknown), std::vector<int>{2});
+
+	// Partial wildcards are literal names, not patterns
+	matcher.insert(makeUri("unk*", 0x00020001, 1, 0x8001), 3);
+	EXPECT_EQ(matcher.match(unknown), std::vector<int>{2});
+}
+
+TEST_F(TestUUriMatcher, DuplicateFiltersAreSeparateEntries) {
+	UUriMatcher<int> matcher;
+	auto first = matcher.insert(uri_, 1);
+	matcher.insert(uri_, 2);
+	EXPECT_EQ(sorted(matcher.match(uri_)), (std::vector<int>{1, 2}));
+
+	EXPECT_TRUE(matcher.erase(first));
+	EXPECT_EQ(matcher.match(uri_), std::vector<int>{2});
+}
+
+TEST_F(TestUUriMatcher, EraseRemovesOnlyThatEntry) {
+	UUriMatcher<int> matcher;
+	auto exact = matcher.insert(uri_, 1);
+	auto wild = matcher.insert(makeUri("*", 0x0000FFFF, 0xFF, 0xFFFF), 2);
+
+	EXPECT_TRUE(matcher.erase(wild));
+	EXPECT_FALSE(matcher.erase(wild));
+	EXPECT_EQ(matcher.match(uri_), std::vector<int>{1});
+
+	EXPECT_TRUE(matcher.erase(exact));
+	EXPECT_TRUE(matcher.empty());
+	EXPECT_TRUE(matcher.match(uri_).empty());
+}
+
+TEST_F(TestUUriMatcher, ZeroInstanceUriVisitedOnce) {
+	// A URI with instance ID 0 produces the same key for the exact and
+	// instance wildcard probes. The filter must still only match once.
+	UUriMatcher<int> matcher;
+	auto uri = makeUri("host", 0x00000001, 1, 0x8001);
+	matcher.insert(uri, 1);
+	EXPECT_EQ(matcher.match(uri), std::vector<int>{1});
+}
+
+TEST_F(TestUUriMatcher, ClearRemovesEverything) {
+	UUriMatcher<int> matcher;
+	for (int i = 0; i < 100; ++i) {
+		matcher.insert(makeUri("host", 0x00020001, 1, 0x8000 + i), i);
+	}
+	EXPECT_EQ(matcher.size(), 100);
+
+	matcher.clear();
+	EXPECT_TRUE(matcher.empty());
+	EXPECT_TRUE(matcher.match(uri_).empty());
+}
+
+TEST_F(TestUUriMatcher, ForEachMatchVisitsAll) {
+	UUriMatcher<std::string> matcher;
+	matcher.insert(uri_, "exact");
+	matcher.insert(makeUri("host", 0x00020001, 1, 0xFFFF), "wild");
+
+	size_t count = 0;
+	matcher.forEachMatch(uri_, [&count](const std::string&) { ++count; });
+	EXPECT_EQ(count, 2);
+}
+
+}  // namespace
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+#include <up-cpp/utils/UuidMap.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+using namespace uprotocol;
+using Map = uprotocol::utils::UuidMap<int>;
+
+class TestUuidMap : public testing::Test {
+protected:
+	// Run once per TEST_F.
+	// Used to set up clean environments per test.
+	void SetUp() override {}
+	void TearDown() override {}
+
+	// Run once per execution of the test application.
+	// Used for setup of all tests. Has access to this instance.
+	TestUuidMap() = default;
+	~TestUuidMap() = default;
+
+	// Run once per execution of the test application.
+	// Used only for global setup outside of tests.
+	static void SetUpTestSuite() {}
+	static void TearDownTestSuite() {}
+
+	static v1::UUID makeUuid(uint64_t msb, uint64_t lsb) {
+		v1::UUID uuid;
+		uuid.set_msb(msb);
+		uuid.set_lsb(lsb);
+		return uuid;
+	}
+};
+
+TEST_F(TestUuidMap, InsertTakeContains) {
+	Map map;
+	const auto key = makeUuid(1, 2);
+	EXPECT_TRUE(map.empty());
+	EXPECT_FALSE(map.contains(key));
+
+	EXPECT_TRUE(map.insert(key, 10));
+	EXPECT_TRUE(map.contains(key));
+	EXPECT_EQ(map.size(), 1);
+
+	int value = 0;
+	EXPECT_FALSE(map.take(makeUuid(2, 1), value));
+	EXPECT_TRUE(map.take(key, value));
+	EXPECT_EQ(value, 10);
+	EXPECT_FALSE(map.contains(key));
+	EXPECT_FALSE(map.take(key, value));
+	EXPECT_TRUE(map.empty());
+}
+
+TEST_F(TestUuidMap, DuplicateInsertRejected) {
+	Map map;
+	const auto key = makeUuid(5, 6);
+	EXPECT_TRUE(map.insert(key, 1));
+	EXPECT_FALSE(map.insert(key, 2));
+	EXPECT_EQ(map.size(), 1);
+
+	int value = 0;
+	EXPECT_TRUE(map.take(key, value));
+	EXPECT_EQ(value, 1);
+}
+
+TEST_F(TestUuidMap, GrowsPastInitialCapacity) {
+	std::mt19937_64 random(7);
+	std::vector<v1::UUID> keys;
+	Map map(4);
+	for (int i = 0; i < 10000; ++i) {
+		// Unique lsb, random msb
+		keys.push_back(makeUuid(random(), i));
+		EXPECT_TRUE(map.insert(keys.back(), int(i)));
+	}
+	EXPECT_EQ(map.size(), keys.size());
+
+	for (int i = 0; i < static_cast<int>(keys.size()); ++i) {
+		int value = -1;
+		EXPECT_TRUE(map.take(keys[i], value));
+		EXPECT_EQ(value, i);
+	}
+	EXPECT_TRUE(map.empty());
+}
+
+TEST_F(TestUuidMap, ChurnKeepsEntriesReachable) {
+	// Sequential keys share their msb, as UUIDs from one builder often do,
+	// and collide heavily in a small table.
+	std::mt19937_64 random(42);
+	std::set<uint64_t> present;
+	Map map;
+	for (int round = 0; round < 20000; ++round) {
+		const uint64_t lsb = random() % 512;
+		int value = 0;
+		if (present.count(lsb) != 0) {
+			EXPECT_TRUE(map.take(makeUuid(7, lsb), value));
+			EXPECT_EQ(value, static_cast<int>(lsb));
+			present.erase(lsb);
+		} else {
+			EXPECT_TRUE(map.insert(makeUuid(7, lsb), static_cast<int>(lsb)));
+			present.insert(lsb);
+		}
+	}
+
+	EXPECT_EQ(map.size(), present.size());
+	for (uint64_t lsb = 0; lsb < 512; ++lsb) {
+		EXPECT_EQ(map.contains(makeUuid(7, lsb)), present.count(lsb) != 0);
+	}
+}
+
+TEST_F(TestUuidMap, DrainVisitsAll) {
+	Map map;
+	for (int i = 0; i < 100; ++i) {
+		map.insert(makeUuid(i, i * 3), int(i));
+	}
+
+	std::set<int> drained;
+	map.drain([&drained](int&& value) { drained.insert(value); });
+	EXPECT_EQ(drained.size(), 100);
+	EXPECT_TRUE(map.empty());
+	EXPECT_FALSE(map.contains(makeUuid(1, 3)));
+
+	EXPECT_TRUE(map.insert(makeUuid(1, 3), 1));
+}
+
+}  // namespace
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2024 Contributors to the Eclipse Foundation
+//
+// See the NOTICE file(s) distributed with this work for additional
+// information regarding copyright ownership.
+//
+// This program and the accompanying materials are made available under the
+// terms of the Apache License Version 2.0 which is available at
+// https://www.apache.org/licenses/LICENSE-2.0
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef UP_CPP_TEST_ALLOCATIONCOUNTER_H
+#define UP_CPP_TEST_ALLOCATIONCOUNTER_H
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace uprotocol::test {
+
+/// @brief Number of allocations made through any form of the global
+///        operator new since the program started.
+///
+/// @remarks Only available to targets that link AllocationCounter.cpp, which
+///          replaces the global operator new and delete.
+size_t allocationCount() noexcept;
+
+/// @brief Records the average number of allocations per benchmark iteration
+///        as a counter, between construction and destruction.
+class AllocationCounter {
+public:
+	AllocationCounter(benchmark::State& state, std::string name)
+	    : state_(state), name_(std::move(name)), start_(allocationCount()) {}
+
+	~AllocationCounter() {
+		state_.counters[name_] = benchmark::Counter(
+		    static_cast<double>(allocationCount() - start_),
+		    benchmark::Counter::kAvgIterations);
+		state_.SetItemsProcessed(state_.iterations());
+	}
+
+	AllocationCounter(const AllocationCounter&) = delete;
+	AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+private:
+	benchmark::State& state_;
+	std::string name_;
+	size_t start_;
+};
+
+}  // namespace uprotocol::test
+
+#endif  // UP_CPP_TEST_ALLOCATIONCOUNTER_H